@@ -0,0 +1,89 @@
+﻿#include "bam.h"
+
+static volatile unsigned char *bam_port;                    // 출력 포트
+static unsigned char bam_levels[BAM_CHANNELS];              // 채널별 밝기 (0 ~ 255)
+static unsigned char bam_planes[2][8];                      // 비트 평면 이중 버퍼 (평면 b = 비트 b가 1인 채널들)
+static volatile unsigned char bam_front;                    // ISR이 출력 중인 버퍼 번호
+static volatile unsigned char bam_pending;                  // 다음 프레임 시작에 버퍼를 바꿀지 여부
+static unsigned char bam_bit;                               // ISR이 다음에 출력할 비트 평면 번호
+
+// BAM 초기화 함수
+void bam_init(volatile unsigned char *port) {
+	unsigned char i;
+
+	bam_port = port;
+	for (i = 0; i < BAM_CHANNELS; i++) {
+		bam_levels[i] = 0;
+	}
+	for (i = 0; i < 8; i++) {
+		bam_planes[0][i] = 0;
+		bam_planes[1][i] = 0;
+	}
+	bam_front = 0;
+	bam_pending = 0;
+	bam_bit = 0;
+	*bam_port = 0x00;
+
+	BAM_TCCR = BAM_WGM | BAM_CLOCK_SELECT;   // CTC 모드 (TOP = OCR), clk/256
+	BAM_TCNT = 0;
+	BAM_OCR = 0;                             // 첫 인터럽트는 바로 (1단위 후)
+	TIMSK |= (1 << BAM_OCIE);                // 비교 일치 인터럽트 허용
+}
+
+// 채널 밝기 변경 함수
+void bam_set(unsigned char channel, unsigned char level) {
+	if (channel < BAM_CHANNELS) {
+		bam_levels[channel] = level;
+	}
+}
+
+// 8채널 밝기 일괄 변경 함수
+void bam_set_all(const unsigned char *levels) {
+	unsigned char i;
+
+	for (i = 0; i < BAM_CHANNELS; i++) {
+		bam_levels[i] = levels[i];
+	}
+	bam_commit();
+}
+
+// 채널 밝기 읽기 함수
+unsigned char bam_get(unsigned char channel) {
+	return (channel < BAM_CHANNELS) ? bam_levels[channel] : 0;
+}
+
+// 변경 내용 반영 함수
+// ISR이 읽지 않는 뒤쪽 버퍼에 비트 평면을 다시 만든 뒤, 다음 프레임 시작에 바꾸도록 요청합니다.
+// (프레임 도중에 바뀌면 한 프레임 동안 이전 값과 새 값이 섞여 깜빡일 수 있음)
+void bam_commit(void) {
+	unsigned char *planes;
+	unsigned char ch, b;
+
+	bam_pending = 0;                        // 뒤쪽 버퍼를 만드는 동안 ISR이 바꾸지 않도록 (1바이트라 원자적)
+	planes = bam_planes[bam_front ^ 1];
+	for (b = 0; b < 8; b++) {
+		unsigned char plane = 0;
+		for (ch = 0; ch < BAM_CHANNELS; ch++) {
+			if (bam_levels[ch] & (1 << b)) {
+				plane |= (1 << ch);
+			}
+		}
+		planes[b] = plane;
+	}
+	bam_pending = 1;
+}
+
+// 비트 평면 전환 인터럽트
+// 평면 b를 출력하고 2^b 단위 뒤에 다시 들어오도록 OCR을 설정합니다. (CTC 주기 = OCR + 1)
+// 평면 0은 1단위(16MHz에서 256클럭)뿐이므로, 다른 ISR이 그보다 오래 인터럽트를 막으면 그 프레임의 평면 0이 길어집니다.
+ISR(BAM_vect) {
+	unsigned char b = bam_bit;
+
+	if (b == 0 && bam_pending) {            // 프레임 경계에서만 버퍼 교체
+		bam_front ^= 1;
+		bam_pending = 0;
+	}
+	*bam_port = bam_planes[bam_front][b];
+	BAM_OCR = (unsigned char)((1 << b) - 1);
+	bam_bit = (b + 1) & 7;
+}
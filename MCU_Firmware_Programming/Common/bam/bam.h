@@ -0,0 +1,47 @@
+﻿#ifndef BAM_H_
+#define BAM_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL // 실습 보드 기본 클럭 (프로젝트에서 먼저 정의하면 그 값을 사용)
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "../timers/timers.h"
+
+// 비트 각 변조(BAM, Bit Angle Modulation) 엔진
+// 8비트 포트 하나에 연결된 LED 8개를 각각 256단계로 밝기 조절합니다.
+//   - 한 프레임을 밝기의 비트 수(8)만큼의 구간으로 나누고, 비트 b 구간의 길이를 2^b 단위로 둡니다.
+//   - 각 구간 시작에 "그 비트가 1인 채널" 8개를 모은 포트 바이트(비트 평면)를 한 번에 출력합니다.
+//   - 소프트웨어 PWM처럼 프레임마다 256번 비교하지 않고, 프레임당 인터럽트 8번으로 끝납니다.
+// 8비트 타이머(timers.h의 BAM_TIMER, 기본 Timer2)를 CTC 모드, 256분주로 사용합니다. (1단위 = 256 / F_CPU, 16MHz에서 16us)
+// 한 프레임은 255단위로 16MHz에서 4.08ms (245Hz), 14.7456MHz에서 4.43ms (226Hz)라 깜빡임이 보이지 않습니다.
+#define BAM_CHANNELS        8
+#if BAM_TIMER == 2
+#define BAM_TCCR            TCCR2
+#define BAM_OCR             OCR2
+#define BAM_TCNT            TCNT2
+#define BAM_OCIE            OCIE2
+#define BAM_WGM             (1 << WGM21)
+#define BAM_CLOCK_SELECT    (1 << CS22)                 // Timer2 CS22:CS20 = 100 → clk/256
+#define BAM_vect            TIMER2_COMP_vect
+#else
+#define BAM_TCCR            TCCR0
+#define BAM_OCR             OCR0
+#define BAM_TCNT            TCNT0
+#define BAM_OCIE            OCIE0
+#define BAM_WGM             (1 << WGM01)
+#define BAM_CLOCK_SELECT    ((1 << CS02) | (1 << CS01)) // Timer0 CS02:CS00 = 110 → clk/256
+#define BAM_vect            TIMER0_COMP_vect
+#endif
+#define BAM_FRAME_HZ        (F_CPU / 256 / 255)
+
+TIMER_CLAIM(BAM_TIMER, bam)
+
+void bam_init(volatile unsigned char *port);                // port의 8비트를 BAM 출력으로 쓰고 타이머 시작 (DDR은 호출하는 쪽에서 설정)
+void bam_set(unsigned char channel, unsigned char level);   // 채널 밝기 변경 (bam_commit() 전까지는 출력에 반영되지 않음)
+void bam_set_all(const unsigned char *levels);              // 8채널 밝기를 한 번에 변경하고 반영
+void bam_commit(void);                                      // 변경한 밝기를 다음 프레임 시작부터 한꺼번에 반영
+unsigned char bam_get(unsigned char channel);               // 채널의 (마지막으로 설정한) 밝기
+
+#endif /* BAM_H_ */
@@ -0,0 +1,134 @@
+﻿#include "bcd.h"
+
+// 압축 BCD(바이트당 2자리, packed[0]이 가장 낮은 두 자리)를 큰 자리부터 한 자리씩 풀어 씀
+static void bcd_unpack(const unsigned char *packed, unsigned char *digits, unsigned char count) {
+	unsigned char i;
+
+	for (i = 0; i < count; i++) {
+		unsigned char b = packed[(count - 1 - i) >> 1];
+
+		digits[i] = ((count - 1 - i) & 1) ? (b >> 4) : (b & 0x0F);
+	}
+}
+
+// 압축 BCD 한 바이트의 두 자리 중 5 이상인 자리에 3을 더함 (다음 시프트에서 10이 윗자리 자리올림이 되도록)
+static unsigned char bcd_adjust(unsigned char b) {
+	if ((b & 0x0F) >= 0x05) {
+		b += 0x03;
+	}
+	if (b >= 0x50) {
+		b += 0x30;
+	}
+	return b;
+}
+
+// 16비트 double dabble
+// 65535는 5자리라 3바이트(6자리)에 담고, 첫 3비트는 어느 자리도 5가 될 수 없으므로 보정 없이 밀어 넣습니다.
+void bcd_dabble16(unsigned int value, unsigned char *digits) {
+	unsigned char packed[3];
+	unsigned char i;
+
+	packed[0] = (unsigned char)((value >> 13) & 0x07); // 상위 3비트 (0 ~ 7)
+	packed[1] = 0;
+	packed[2] = 0;
+	value <<= 3;
+	for (i = 3; i < 16; i++) {
+		packed[0] = bcd_adjust(packed[0]);
+		packed[1] = bcd_adjust(packed[1]);
+		packed[2] = (unsigned char)((packed[2] << 1) | (packed[1] >> 7));
+		packed[1] = (unsigned char)((packed[1] << 1) | (packed[0] >> 7));
+		packed[0] = (unsigned char)((packed[0] << 1) | ((value & 0x8000) ? 1 : 0));
+		value <<= 1;
+	}
+	bcd_unpack(packed, digits, BCD16_DIGITS);
+}
+
+// 32비트 double dabble (10자리 = 5바이트, 자리올림은 아래 바이트부터 차례로 전달)
+void bcd_dabble32(unsigned long value, unsigned char *digits) {
+	unsigned char packed[5] = { 0, 0, 0, 0, 0 };
+	unsigned char i, j;
+
+	for (i = 0; i < 32; i++) {
+		unsigned char carry = (value & 0x80000000UL) ? 1 : 0;
+
+		value <<= 1;
+		for (j = 0; j < 5; j++) {
+			unsigned char b = bcd_adjust(packed[j]);
+
+			packed[j] = (unsigned char)((b << 1) | carry);
+			carry = b >> 7;
+		}
+	}
+	bcd_unpack(packed, digits, BCD32_DIGITS);
+}
+
+// 16비트 역수 곱셈
+// 0xCCCD / 2^19 = 0.1000003이라 0 ~ 65535 전 범위에서 x * 0xCCCD >> 19 == x / 10 입니다.
+void bcd_recip16(unsigned int value, unsigned char *digits) {
+	unsigned char i = BCD16_DIGITS;
+
+	while (i > 0) {
+		unsigned int q = (unsigned int)(((unsigned long)value * 0xCCCDUL) >> 19);
+
+		digits[--i] = (unsigned char)(value - q * 10);
+		value = q;
+	}
+}
+
+// 32비트 10 나누기 (몫과 나머지)
+// q ≈ x * 0.8 (= 0.11001100...b)을 시프트와 덧셈으로 만들고 8로 나눈 뒤, 1 모자란 경우만 나머지로 바로잡습니다.
+// 64비트 곱셈 없이 32비트 시프트(대부분 바이트 이동)와 덧셈만 씁니다.
+static unsigned long bcd_div10(unsigned long x, unsigned char *rem) {
+	unsigned long q = (x >> 1) + (x >> 2);
+	unsigned char r;
+
+	q += q >> 4;
+	q += q >> 8;
+	q += q >> 16;
+	q >>= 3;
+	r = (unsigned char)(x - ((q << 3) + (q << 1))); // 0 ~ 19
+	if (r > 9) {
+		q++;
+		r -= 10;
+	}
+	*rem = r;
+	return q;
+}
+
+// 32비트 역수 곱셈
+// 값이 16비트 안으로 들어오면 나머지 자리는 16비트 방식으로 구합니다.
+void bcd_recip32(unsigned long value, unsigned char *digits) {
+	unsigned char i = BCD32_DIGITS;
+
+	while (value > 0xFFFFUL) {
+		value = bcd_div10(value, &digits[--i]);
+	}
+	while (i > 0) {
+		unsigned int q = (unsigned int)(((unsigned long)(unsigned int)value * 0xCCCDUL) >> 19);
+
+		digits[--i] = (unsigned char)((unsigned int)value - q * 10);
+		value = q;
+	}
+}
+
+// 16비트 자릿수 캐시 함수
+unsigned char bcd_cache16(bcd_cache16_t *cache, unsigned int value) {
+	if (cache->valid && cache->value == value) {
+		return 0;
+	}
+	bcd16(value, cache->digits);
+	cache->value = value;
+	cache->valid = 1;
+	return 1;
+}
+
+// 32비트 자릿수 캐시 함수
+unsigned char bcd_cache32(bcd_cache32_t *cache, unsigned long value) {
+	if (cache->valid && cache->value == value) {
+		return 0;
+	}
+	bcd32(value, cache->digits);
+	cache->value = value;
+	cache->valid = 1;
+	return 1;
+}
@@ -0,0 +1,48 @@
+﻿#ifndef BCD_H_
+#define BCD_H_
+
+// 나눗셈 없는 2진 → 10진 자릿수 변환
+// AVR에는 나눗셈 명령이 없어 N / 1000, N % 1000 ... 을 하면 연산마다 200클럭 안팎의 소프트웨어 나눗셈이 돕니다.
+// 여기서는 두 가지 방식으로 자릿수를 구하며, 결과는 큰 자리부터 digits[]에 0~9로 채웁니다.
+//   - double dabble: 비트를 하나씩 왼쪽으로 밀어 넣으면서 5 이상인 BCD 자리에 3을 더합니다. (덧셈, 비교, 시프트만 사용)
+//   - 역수 곱셈: x / 10을 x * (2^19 / 10)의 상위 비트로 구합니다. (16비트는 곱셈 1번, 32비트는 4/5 곱을 시프트와 덧셈으로 전개)
+// 표시처럼 같은 값을 계속 쓰는 곳은 bcd_cache16()/bcd_cache32()로 값이 바뀔 때만 변환합니다.
+#define BCD16_DIGITS        5   // 0 ~ 65535
+#define BCD32_DIGITS        10  // 0 ~ 4294967295
+
+#define BCD_DABBLE          0
+#define BCD_RECIP           1
+#ifndef BCD_METHOD
+#define BCD_METHOD          BCD_RECIP   // bcd16()/bcd32()와 캐시가 쓰는 방식 (Project Properties > Symbols에서 변경)
+#endif
+
+// 값이 바뀔 때만 다시 변환하는 자릿수 캐시 (valid = 0으로 두면 다음 호출에서 반드시 변환)
+typedef struct {
+	unsigned int value;
+	unsigned char valid;
+	unsigned char digits[BCD16_DIGITS];
+} bcd_cache16_t;
+
+typedef struct {
+	unsigned long value;
+	unsigned char valid;
+	unsigned char digits[BCD32_DIGITS];
+} bcd_cache32_t;
+
+void bcd_dabble16(unsigned int value, unsigned char *digits);  // digits[BCD16_DIGITS]
+void bcd_dabble32(unsigned long value, unsigned char *digits); // digits[BCD32_DIGITS]
+void bcd_recip16(unsigned int value, unsigned char *digits);   // digits[BCD16_DIGITS]
+void bcd_recip32(unsigned long value, unsigned char *digits);  // digits[BCD32_DIGITS]
+
+#if BCD_METHOD == BCD_DABBLE
+#define bcd16(value, digits)    bcd_dabble16(value, digits)
+#define bcd32(value, digits)    bcd_dabble32(value, digits)
+#else
+#define bcd16(value, digits)    bcd_recip16(value, digits)
+#define bcd32(value, digits)    bcd_recip32(value, digits)
+#endif
+
+unsigned char bcd_cache16(bcd_cache16_t *cache, unsigned int value);   // 값이 바뀌어 다시 변환했으면 1
+unsigned char bcd_cache32(bcd_cache32_t *cache, unsigned long value);  // 값이 바뀌어 다시 변환했으면 1
+
+#endif /* BCD_H_ */
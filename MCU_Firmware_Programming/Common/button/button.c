@@ -0,0 +1,117 @@
+﻿#include "button.h"
+
+static const volatile unsigned char *button_pin;            // 버튼 입력 포트 (PINx)
+static unsigned char button_mask;                           // 버튼으로 쓰는 비트
+static volatile unsigned char button_stable;                // 채터링을 거른 상태 (1 = 눌림)
+static unsigned char button_ct0 = 0xFF;                     // 세로 카운터 하위 비트 (비트별로 하나씩)
+static unsigned char button_ct1 = 0xFF;                     // 세로 카운터 상위 비트
+static unsigned char button_held[8];                        // 비트별 누르고 있는 샘플 수 (BUTTON_HOLD_SAMPLES에서 멈춤)
+
+static button_event_t button_queue[BUTTON_QUEUE_SIZE];
+static volatile unsigned char button_head;                  // 다음에 넣을 자리 (넣는 쪽만 바꿈)
+static volatile unsigned char button_tail;                  // 다음에 꺼낼 자리 (꺼내는 쪽만 바꿈)
+
+// 큐에 넣기 (인터럽트 금지 상태에서 호출)
+// 자리를 채운 뒤 head를 옮기므로(1바이트라 원자적) 꺼내는 쪽은 다 쓴 자리만 봅니다.
+static unsigned char button_push(unsigned char type, unsigned char code) {
+	unsigned char head = button_head;
+	unsigned char next = (head + 1) & (BUTTON_QUEUE_SIZE - 1);
+
+	if (next == button_tail) {
+		return 0;
+	}
+	button_queue[head].type = type;
+	button_queue[head].code = code;
+	button_head = next;
+	return 1;
+}
+
+// 비트마다 이벤트 넣기
+static void button_emit(unsigned char type, unsigned char bits) {
+	unsigned char i;
+
+	for (i = 0; bits; i++, bits >>= 1) {
+		if (bits & 0x01) {
+			button_push(type, i);
+		}
+	}
+}
+
+// 샘플 틱 핸들러 (BUTTON_SAMPLE_MS마다 틱 인터럽트 안에서 호출)
+// 확정 상태와 다른 비트만 카운터가 11 → 10 → 01 → 00 → 11로 돌고, 한 바퀴(4번 연속)를 돌면 상태를 뒤집습니다.
+// 같은 비트는 카운터가 11로 돌아가므로 중간에 한 번이라도 튀면 처음부터 다시 셉니다.
+static void button_sample(void) {
+	unsigned char raw = (unsigned char)~*button_pin & button_mask;
+	unsigned char stable = button_stable;
+	unsigned char diff = stable ^ raw;
+	unsigned char pressed;
+	unsigned char i;
+
+	button_ct0 = ~(button_ct0 & diff);
+	button_ct1 = button_ct0 ^ (button_ct1 & diff);
+	diff &= button_ct0 & button_ct1;            // 카운터가 한 바퀴 돈 비트
+	if (diff) {
+		stable ^= diff;
+		button_stable = stable;
+		button_emit(BUTTON_PRESS, diff & stable);
+		button_emit(BUTTON_RELEASE, diff & ~stable);
+	}
+
+	// 길게 누름: 눌린 버튼이 없으면 건너뜀
+	pressed = stable;
+	for (i = 0; pressed; i++, pressed >>= 1) {
+		if (!(pressed & 0x01)) {
+			continue;
+		}
+		if (diff & (1 << i)) {
+			button_held[i] = 0;                 // 방금 눌림
+		} else if (button_held[i] < BUTTON_HOLD_SAMPLES && ++button_held[i] == BUTTON_HOLD_SAMPLES) {
+			button_push(BUTTON_HOLD, i);
+		}
+	}
+}
+
+// 버튼 초기화 함수
+// 처음 샘플은 모두 떼어진 상태에서 시작하므로, 켤 때부터 눌려 있던 버튼은 채터링 시간 뒤 BUTTON_PRESS를 냅니다.
+unsigned char button_init(const volatile unsigned char *pin, unsigned char mask) {
+	unsigned char sreg = SREG;
+
+	cli();
+	button_pin = pin;
+	button_mask = mask;
+	button_stable = 0;
+	button_ct0 = 0xFF;
+	button_ct1 = 0xFF;
+	button_head = 0;
+	button_tail = 0;
+	SREG = sreg;
+	return tick_add_every(button_sample, BUTTON_SAMPLE_MS);
+}
+
+// 이벤트 꺼내기 함수
+unsigned char button_get(button_event_t *event) {
+	unsigned char tail = button_tail;
+
+	if (tail == button_head) {
+		return 0;
+	}
+	*event = button_queue[tail];
+	button_tail = (tail + 1) & (BUTTON_QUEUE_SIZE - 1);
+	return 1;
+}
+
+// 이벤트 넣기 함수 (메인 루프나 다른 ISR에서, 틱 핸들러와 겹치지 않도록 넣는 동안만 인터럽트를 막음)
+unsigned char button_post(unsigned char type, unsigned char code) {
+	unsigned char ok;
+	unsigned char sreg = SREG;
+
+	cli();
+	ok = button_push(type, code);
+	SREG = sreg;
+	return ok;
+}
+
+// 현재 상태 반환 함수
+unsigned char button_state(void) {
+	return button_stable;
+}
@@ -0,0 +1,47 @@
+﻿#ifndef BUTTON_H_
+#define BUTTON_H_
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "../tick/tick.h"
+
+// 버튼 입력 서비스
+// 풀업을 켠 입력 포트(눌리면 0)를 1ms 틱(tick 모듈)에서 BUTTON_SAMPLE_MS마다 읽어 채터링을 걸러 내고,
+// 비트별로 눌림/뗌/길게 누름 이벤트를 큐에 넣습니다. 메인 루프는 button_get()으로 이벤트만 꺼내 처리합니다.
+//   - 비트마다 2비트 카운터 8개를 바이트 두 개에 세로로 쌓아(vertical counter) 8개 버튼을 한 번에 셉니다.
+//     읽은 값이 확정 상태와 연속 4번 다르면 상태를 바꾸므로, 15 ~ 20ms보다 짧은 튐은 무시됩니다.
+//   - 메인 루프가 바쁘거나 잠들어 있어도 샘플링은 틱 인터럽트에서 하므로 짧게 누른 버튼도 놓치지 않습니다.
+//   - 아무 버튼도 눌려 있지 않으면 틱마다 명령 몇 개로 끝나고, 큐가 비어 있으면 button_get()도 바로 돌아갑니다.
+// tick_init()은 호출하는 쪽에서 먼저 해야 하며, 포트의 DDR(입력)과 풀업 설정도 호출하는 쪽에서 합니다.
+//
+// 이벤트 형식은 키패드와 같이 씁니다. code는 버튼이면 비트 번호(0 ~ 7), 키패드면 keypad_map의 문자('0' ~ '9', '*', '#')라
+// 겹치지 않으므로, 키패드 스캔 결과도 button_post()로 같은 큐에 넣어 한 곳에서 처리할 수 있습니다.
+#ifndef BUTTON_SAMPLE_MS
+#define BUTTON_SAMPLE_MS    5                           // 샘플 주기 (ms)
+#endif
+#ifndef BUTTON_HOLD_MS
+#define BUTTON_HOLD_MS      800                         // 이만큼 누르고 있으면 BUTTON_HOLD 한 번
+#endif
+#define BUTTON_HOLD_SAMPLES (BUTTON_HOLD_MS / BUTTON_SAMPLE_MS)
+#if BUTTON_HOLD_SAMPLES < 1 || BUTTON_HOLD_SAMPLES > 255
+#error "BUTTON_HOLD_MS / BUTTON_SAMPLE_MS must be 1 ~ 255"
+#endif
+#define BUTTON_QUEUE_SIZE   8                           // 이벤트 큐 크기 (2의 거듭제곱)
+
+// 이벤트 종류
+#define BUTTON_PRESS        1                           // 눌림 (채터링이 끝난 뒤 한 번)
+#define BUTTON_RELEASE      2                           // 뗌
+#define BUTTON_HOLD         3                           // 눌린 채 BUTTON_HOLD_MS가 지남 (누를 때마다 한 번)
+
+typedef struct {
+	unsigned char type;                                 // BUTTON_PRESS / BUTTON_RELEASE / BUTTON_HOLD
+	unsigned char code;                                 // 버튼 비트 번호 또는 키패드 문자
+} button_event_t;
+
+// pin의 mask 비트를 버튼으로 보고 샘플링 시작 (예: button_init(&PIND, 0xFF), 틱 핸들러 자리가 없으면 0 반환)
+unsigned char button_init(const volatile unsigned char *pin, unsigned char mask);
+unsigned char button_get(button_event_t *event);            // 이벤트 하나를 꺼냄 (없으면 0 반환)
+unsigned char button_post(unsigned char type, unsigned char code); // 이벤트를 큐에 넣음 (가득 차면 버리고 0 반환)
+unsigned char button_state(void);                           // 채터링을 거른 현재 상태 (1 = 눌림)
+
+#endif /* BUTTON_H_ */
@@ -0,0 +1,288 @@
+﻿#include "fnd.h"
+
+// 글자 번호 → 세그먼트 패턴 (비트 0~7 = a, b, c, d, e, f, g, dp)
+// 예제들의 Font[18]과 같되, b와 같던 6(0x7C)에 a 세그먼트를 더하고 '-'는 d 대신 g 세그먼트로 표시합니다.
+static const unsigned char fnd_font[19] PROGMEM = {
+	0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,         // 0 ~ 7
+	0x7F, 0x67, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71,         // 8, 9, A, b, C, d, E, F
+	0x40, 0x80, 0x00                                        // -, ., 꺼짐
+};
+
+// 화면 버퍼 3벌: 스캔 순서(자리 선택 핀 순서)별 세그먼트 패턴, 1 = 켜짐
+// 세 번호는 항상 0, 1, 2를 하나씩 나눠 가지며, 바꿀 때는 번호만 맞바꾸고 내용은 옮기지 않습니다.
+//   fnd_back   응용이 쓰는 버퍼 (ISR은 읽지 않음)
+//   fnd_ready  마지막으로 다 쓴 화면 (fnd_fresh = 1이면 ISR이 아직 가져가지 않음)
+//   fnd_front  ISR이 지금 표시 중인 화면 (ISR 전용, 프레임 첫 자리에서만 바뀜)
+static volatile unsigned char fnd_buf[3][FND_DIGITS];
+static unsigned char fnd_back = 0;
+static volatile unsigned char fnd_ready = 1;
+static unsigned char fnd_front = 2;
+static volatile unsigned char fnd_fresh;                    // fnd_ready에 ISR이 아직 보지 않은 화면이 있음
+static unsigned char fnd_batch;                             // fnd_begin() 중첩 깊이 (0이 아니면 쓸 때마다 내보내지 않음)
+static unsigned char fnd_dirty;                             // 마지막으로 내보낸 뒤 fnd_back이 바뀜
+static unsigned char fnd_scan;                              // 다음에 켤 자리 선택 핀 (ISR 전용, 0 = FND_DIG_PIN0)
+static unsigned char fnd_bit;                               // fnd_scan 핀의 비트 마스크 (ISR 전용)
+static unsigned int fnd_hz;                                 // 실제 화면 갱신 빈도
+static unsigned int fnd_top;                                // 자리 한 칸의 길이 - 1 (타이머 tick, OCRnA)
+static volatile unsigned int fnd_on[FND_DIGITS];            // 스캔 순서별 켜진 시간 (tick, 0 = 꺼짐, fnd_top 초과 = 칸 전체)
+static unsigned char fnd_level[FND_DIGITS];                 // 스캔 순서별 자리 밝기
+static unsigned char fnd_global;                            // 전체 밝기
+static bcd_cache16_t fnd_digits;                            // fnd_show()로 마지막에 표시한 값의 자릿수
+
+// FND 초기화 함수
+// 자리 하나의 표시 시간 = 1 / (refresh_hz * FND_DIGITS), 이 주기로 비교 일치 인터럽트가 들어옵니다.
+void fnd_init(unsigned int refresh_hz) {
+	unsigned long top;
+	unsigned char i;
+
+	if (refresh_hz == 0) {
+		refresh_hz = FND_REFRESH_HZ;
+	} else if (refresh_hz < FND_REFRESH_MIN) {
+		refresh_hz = FND_REFRESH_MIN;
+	} else if (refresh_hz > FND_REFRESH_MAX) {
+		refresh_hz = FND_REFRESH_MAX;
+	}
+	top = (F_CPU / 8 + (unsigned long)refresh_hz * FND_DIGITS / 2) / ((unsigned long)refresh_hz * FND_DIGITS) - 1;
+	fnd_hz = (unsigned int)(F_CPU / 8 / ((top + 1) * FND_DIGITS));
+	fnd_top = (unsigned int)top;
+
+	for (i = 0; i < FND_DIGITS; i++) {         // 세 버퍼 모두 비움
+		fnd_buf[0][i] = fnd_buf[1][i] = fnd_buf[2][i] = 0x00;
+	}
+	fnd_back = 0;
+	fnd_ready = 1;
+	fnd_front = 2;
+	fnd_fresh = 0;
+	fnd_batch = 0;
+	fnd_dirty = 0;
+	fnd_digits.valid = 0;
+	fnd_scan = 0;
+	fnd_bit = FND_DIG_FIRST;
+	FND_SEG_PORT = FND_SEG_XOR;                 // 모든 세그먼트 꺼짐
+	FND_SEG_DDR = 0xFF;
+	FND_DIG_OFF();                              // 모든 자리 꺼짐
+	FND_DIG_DDR |= FND_DIG_MASK;
+
+	FND_TCCRB = 0x00;                           // 설정하는 동안 타이머 정지 (ISR도 들어오지 않음)
+	FND_TCCRA = 0x00;
+	FND_TCNT = 0;
+	FND_OCR = fnd_top;
+	FND_OCRB = 0xFFFF;                          // TOP보다 커서 일치하지 않음 (끄지 않음)
+	for (i = 0; i < FND_DIGITS; i++) {
+		fnd_level[i] = 255;
+	}
+	fnd_global = 0;                             // fnd_set_brightness()가 같은 값이면 건너뛰지 않도록
+	fnd_set_brightness(255);
+	FND_TCCRB = FND_WGM | FND_CLOCK_SELECT;     // CTC 모드, clk/8
+	FND_TIMSK |= (1 << FND_OCIE) | (1 << FND_OCIEB); // 자리 전환, 자리 끄기 인터럽트 허용
+}
+
+// 켜진 시간 다시 계산 함수 (스캔 순서 s)
+// 2바이트 값을 ISR이 반만 바뀐 채 읽지 않도록 쓰는 동안만 인터럽트를 막습니다.
+static void fnd_update_on(unsigned char s) {
+	unsigned int product = (unsigned int)fnd_level[s] * fnd_global;
+	unsigned int on;
+	unsigned char sreg;
+
+	if (product == 255U * 255U) {
+		on = 0xFFFF;                            // 칸 전체
+	} else {
+		on = (unsigned int)(((unsigned long)(fnd_top + 1) * product + 65024) / 65025);
+	}
+	sreg = SREG;
+	cli();
+	fnd_on[s] = on;
+	SREG = sreg;
+}
+
+// 전체 밝기 설정 함수 (같은 값이면 바로 돌아가므로 메인 루프에서 계속 불러도 됨)
+void fnd_set_brightness(unsigned char level) {
+	unsigned char s;
+
+	if (level == fnd_global) {
+		return;
+	}
+	fnd_global = level;
+	for (s = 0; s < FND_DIGITS; s++) {
+		fnd_update_on(s);
+	}
+}
+
+// 자리 밝기 설정 함수
+void fnd_set_digit_brightness(unsigned char pos, unsigned char level) {
+	if (pos < FND_DIGITS) {
+		fnd_level[FND_SCAN(pos)] = level;
+		fnd_update_on(FND_SCAN(pos));
+	}
+}
+
+// 전체 밝기 반환 함수
+unsigned char fnd_get_brightness(void) {
+	return fnd_global;
+}
+
+// 화면 갱신 빈도 반환 함수
+unsigned int fnd_refresh_hz(void) {
+	return fnd_hz;
+}
+
+// 화면 내보내기 함수
+// 다 쓴 fnd_back을 fnd_ready와 맞바꾸고, 새 fnd_back에 방금 내보낸 내용을 복사해 이어서 고칠 수 있게 합니다.
+// 인터럽트를 막는 것은 번호 두 개를 바꾸는 동안뿐이고, 복사는 ISR이 읽지 않는 fnd_back에 하므로 막지 않습니다.
+static void fnd_publish(void) {
+	unsigned char b = fnd_back;
+	unsigned char i;
+	unsigned char sreg;
+
+	sreg = SREG;
+	cli();
+	fnd_back = fnd_ready;
+	fnd_ready = b;
+	fnd_fresh = 1;
+	SREG = sreg;
+	for (i = 0; i < FND_DIGITS; i++) {
+		fnd_buf[fnd_back][i] = fnd_buf[b][i];
+	}
+	fnd_dirty = 0;
+}
+
+// fnd_back을 고친 뒤 호출 (묶음 안이 아니면 바로 내보냄)
+static void fnd_changed(void) {
+	fnd_dirty = 1;
+	if (fnd_batch == 0) {
+		fnd_publish();
+	}
+}
+
+// 묶음 시작 함수: fnd_commit()까지의 쓰기를 한 화면으로 모아 한 번에 내보냅니다. (중첩 가능)
+void fnd_begin(void) {
+	fnd_batch++;
+}
+
+// 묶음 끝 함수: 가장 바깥 fnd_commit()에서, 바뀐 내용이 있으면 내보냅니다.
+void fnd_commit(void) {
+	if (fnd_batch != 0 && --fnd_batch == 0 && fnd_dirty) {
+		fnd_publish();
+	}
+}
+
+// 세그먼트 패턴 설정 함수
+void fnd_set_raw(unsigned char pos, unsigned char segments) {
+	if (pos < FND_DIGITS) {
+		fnd_buf[fnd_back][FND_SCAN(pos)] = segments;
+		fnd_digits.valid = 0;                   // 다음 fnd_show()는 같은 값이어도 다시 씀
+		fnd_changed();
+	}
+}
+
+// 글자 번호 → 세그먼트 패턴 함수 (표에 없는 번호는 꺼짐)
+unsigned char fnd_glyph(unsigned char glyph) {
+	if (glyph > FND_BLANK) {
+		glyph = FND_BLANK;
+	}
+	return pgm_read_byte(&fnd_font[glyph]);
+}
+
+// 글자 표시 함수
+void fnd_set_digit(unsigned char pos, unsigned char glyph) {
+	fnd_set_raw(pos, fnd_glyph(glyph));
+}
+
+// 모든 자리 끄기 함수
+void fnd_clear(void) {
+	unsigned char i;
+
+	for (i = 0; i < FND_DIGITS; i++) {
+		fnd_buf[fnd_back][i] = 0x00;
+	}
+	fnd_digits.valid = 0;
+	fnd_changed();
+}
+
+// 10진수 표시 함수
+// 메인 루프에서 매번 불러도 되도록, 마지막으로 표시한 값과 같으면 바로 돌아가고
+// 바뀐 경우에만 나눗셈 없이(bcd 모듈) 자릿수를 구해 버퍼에 씁니다.
+// 자릿수를 모두 쓴 뒤 한 번에 내보내므로, ISR은 다음 프레임 첫 자리부터 새 값 전체를 표시합니다.
+void fnd_show(unsigned int value) {
+	unsigned char i;
+	unsigned char glyph;
+
+	if (!bcd_cache16(&fnd_digits, value)) {
+		return;
+	}
+	for (i = 0; i < FND_DIGITS; i++) {
+		if (value > FND_SHOW_MAX) {
+			glyph = FND_MINUS;
+		} else if (i + BCD16_DIGITS < FND_DIGITS) {
+			glyph = 0;                          // 5자리보다 긴 FND의 앞자리
+		} else {
+			glyph = fnd_digits.digits[i + BCD16_DIGITS - FND_DIGITS];
+		}
+		fnd_buf[fnd_back][FND_SCAN(i)] = pgm_read_byte(&fnd_font[glyph]);
+	}
+	fnd_changed();
+}
+
+// 변수 표시 함수
+// 인터럽트에서 바뀌는 2바이트 변수를 인터럽트를 막은 채 한 번에 읽어 표시하고, 읽은 값을 돌려줍니다.
+// 같은 값으로 다른 일(LED 표시 등)을 할 때 반환값을 쓰면 화면과 어긋나지 않습니다.
+unsigned int fnd_show_from(const volatile unsigned int *value) {
+	unsigned int v;
+	unsigned char sreg;
+
+	sreg = SREG;
+	cli();
+	v = *value;
+	SREG = sreg;
+	fnd_show(v);
+	return v;
+}
+
+// 자리 전환 인터럽트
+// 모든 자리를 끈 뒤 세그먼트를 바꾸고 다음 자리를 켜서, 이전 자리의 패턴이 잠깐 비치는 잔상을 막습니다.
+// 포트, 극성, 자리 순서는 모두 상수라 자리 끄기/켜기는 각각 명령 몇 개로 끝납니다.
+// 칸 시작(TCNT = 0)에 들어와 이번 자리의 켜진 시간을 OCRnB에 넣고, 켜진 시간이 0이면 자리를 켜지 않습니다.
+// 새 화면은 프레임 첫 자리에서만 가져오므로 한 프레임 안의 자리들은 항상 같은 화면에서 나옵니다.
+ISR(FND_vect) {
+	unsigned char s = fnd_scan;
+	unsigned char bit = fnd_bit;
+	unsigned int on = fnd_on[s];
+
+	if (s == 0 && fnd_fresh) {
+		unsigned char f = fnd_front;
+
+		fnd_front = fnd_ready;
+		fnd_ready = f;
+		fnd_fresh = 0;
+	}
+
+	FND_DIG_OFF();
+	FND_OCRB = on;
+	FND_TIFR = (1 << FND_OCFB);                 // 다른 ISR 때문에 늦게 들어왔을 때 지난 칸의 끄기 요청이 새 자리를 끄지 않도록
+	if (on) {
+		FND_SEG_PORT = fnd_buf[fnd_front][s] ^ FND_SEG_XOR;
+		FND_DIG_SELECT(bit);
+		if (FND_TCNT >= on) {                   // 켜진 시간이 ISR 진입 지연보다 짧으면 이미 지나감
+			FND_DIG_OFF();
+		}
+	}
+	if (++s >= FND_DIGITS) {
+		s = 0;
+		bit = FND_DIG_FIRST;
+	} else {
+		bit <<= 1;
+	}
+	fnd_scan = s;
+	fnd_bit = bit;
+#ifdef FND_FRAME_HOOK
+	// 마지막 자리를 켜 둔 채 다음 화면을 준비 (자리 전환은 이미 끝나 있어 표시 타이밍에 영향 없음)
+	if (s == 0) {
+		FND_FRAME_HOOK();
+	}
+#endif
+}
+
+// 자리 끄기 인터럽트 (켜진 시간이 끝나면 칸의 나머지 동안 모든 자리를 끔)
+ISR(FND_OFF_vect) {
+	FND_DIG_OFF();
+}
@@ -0,0 +1,183 @@
+﻿#ifndef FND_H_
+#define FND_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL // 실습 보드 기본 클럭 (프로젝트에서 먼저 정의하면 그 값을 사용)
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include "../timers/timers.h"
+#include "../bcd/bcd.h"
+
+// 인터럽트 구동 다자리 7-Segment(FND) 드라이버
+// 16비트 타이머(timers.h의 FND_TIMER, 기본 Timer3)를 CTC 모드로 돌려 인터럽트 한 번에 한 자리씩 켭니다.
+//   - 표시 내용은 4바이트 세그먼트 버퍼에 있고, 응용은 fnd_show() 등으로 버퍼만 바꾸고 바로 돌아갑니다.
+//   - 버퍼는 3벌(쓰는 중 / 다 쓴 화면 / 표시 중)이라, 응용은 다 쓴 화면을 번호만 바꿔 내보내고
+//     ISR은 프레임 첫 자리에서 가장 최근 화면으로 바꿉니다. 한 프레임에 두 값이 섞여 보이지 않고, 어느 쪽도 기다리지 않습니다.
+//     여러 자리를 나눠 쓸 때는 fnd_begin() ~ fnd_commit()으로 묶으면 다 쓴 뒤 한 번만 내보냅니다.
+//     쓰는 쪽은 한 곳(메인 루프 또는 FND_FRAME_HOOK)이어야 합니다. 둘이 같이 쓰면 서로의 쓰기가 섞입니다.
+//   - ISR에서 바뀌는 2바이트 변수는 fnd_show_from(&변수)로 표시하면 반만 바뀐 값을 읽지 않습니다.
+//   - Segment()처럼 _delay_ms()로 자리를 돌리지 않으므로 메인 루프가 다른 일(릴레이 지연 등)을 해도 화면이 꺼지지 않습니다.
+//   - 밝기는 같은 타이머의 두 번째 비교 채널(OCRnB)로 자리마다 켜진 시간을 줄여 조절합니다.
+//     자리 하나의 칸(slot) 길이와 화면 갱신 빈도는 그대로 두고 칸 안에서 일찍 끄기만 하므로 어두워져도 깜빡임이 늘지 않습니다.
+//     켜진 시간 = 칸 길이 * (자리 밝기 / 255) * (전체 밝기 / 255)
+//
+// 배선과 극성은 프로젝트 전체에 같은 값으로 적용되는 심볼(Project Properties > Symbols, -D)로 정합니다.
+// fnd.c도 같은 값으로 컴파일되어야 하므로 main.c에서 #define하지 말고 심볼로 지정합니다.
+//   FND_BOARD           보드 배선 묶음 (아래 두 가지, 기본은 FND_BOARD_PORTA_C)
+//   FND_TYPE            FND_COMMON_CATHODE / FND_COMMON_ANODE → 세그먼트와 자리 선택이 켜지는 레벨
+//   FND_SEG_ON, FND_DIG_ON  켜지는 레벨(0/1)을 직접 지정 (트랜지스터로 자리를 구동해 레벨이 뒤집힌 보드)
+//   FND_DIGITS          자리 수 (1 ~ 8), FND_DIG_PIN0 첫 자리 선택 핀 번호 (자리 선택은 연속한 핀)
+//                       자리 선택 포트의 나머지 핀을 다른 용도로 쓸 때는 아래 FND_DIG_OFF() 위의 주의 사항을 지킵니다.
+//   FND_ORDER           FND_LEFT_FIRST: 가장 낮은 핀이 왼쪽 자리, FND_RIGHT_FIRST: 가장 낮은 핀이 오른쪽(일의) 자리
+//   FND_FRAME_HOOK      모든 자리를 한 번씩 켠 뒤 인터럽트 안에서 부를 함수 이름 (예: fndlayout_compose, 없으면 부르지 않음)
+//
+//   묶음                세그먼트 a~g, dp    자리 선택     자리 순서          사용 예제
+//   FND_BOARD_PORTA_C   PORTA 0~7           PC0~PC3       PC0 = 천의 자리    Day9 ~ Day11
+//   FND_BOARD_PORTB_G   PORTB 0~7           PG0~PG3       PG0 = 일의 자리    Day6 FND2, Day7 FND3
+//
+// 두 보드 모두 세그먼트는 1, 자리 선택은 0일 때 켜지므로 공통 캐소드 방식으로 동작합니다.
+// (예제 주석의 "공통 애노드"는 폰트 표 기준으로는 맞지 않음)
+#define FND_BOARD_PORTA_C   0
+#define FND_BOARD_PORTB_G   1
+#define FND_COMMON_CATHODE  0                           // 세그먼트 1 = 켜짐, 자리 선택 0 = 켜짐
+#define FND_COMMON_ANODE    1                           // 세그먼트 0 = 켜짐, 자리 선택 1 = 켜짐
+#define FND_LEFT_FIRST      0
+#define FND_RIGHT_FIRST     1
+
+#ifndef FND_BOARD
+#define FND_BOARD           FND_BOARD_PORTA_C
+#endif
+#if FND_BOARD == FND_BOARD_PORTB_G
+#define FND_SEG_PORT        PORTB
+#define FND_SEG_DDR         DDRB
+#define FND_DIG_PORT        PORTG
+#define FND_DIG_DDR         DDRG
+#ifndef FND_ORDER
+#define FND_ORDER           FND_RIGHT_FIRST
+#endif
+#elif FND_BOARD == FND_BOARD_PORTA_C
+#define FND_SEG_PORT        PORTA
+#define FND_SEG_DDR         DDRA
+#define FND_DIG_PORT        PORTC
+#define FND_DIG_DDR         DDRC
+#ifndef FND_ORDER
+#define FND_ORDER           FND_LEFT_FIRST
+#endif
+#else
+#error "FND_BOARD must be FND_BOARD_PORTA_C or FND_BOARD_PORTB_G"
+#endif
+
+#ifndef FND_TYPE
+#define FND_TYPE            FND_COMMON_CATHODE
+#endif
+#ifndef FND_SEG_ON
+#define FND_SEG_ON          ((FND_TYPE == FND_COMMON_CATHODE) ? 1 : 0)
+#endif
+#ifndef FND_DIG_ON
+#define FND_DIG_ON          ((FND_TYPE == FND_COMMON_CATHODE) ? 0 : 1)
+#endif
+#ifndef FND_DIGITS
+#define FND_DIGITS          4
+#endif
+#ifndef FND_DIG_PIN0
+#define FND_DIG_PIN0        0
+#endif
+#if FND_DIGITS < 1 || FND_DIG_PIN0 + FND_DIGITS > 8
+#error "FND_DIGITS / FND_DIG_PIN0 do not fit in one 8-bit port"
+#endif
+
+// 위 설정에서 나오는 상수 (ISR은 이 값들만 씀)
+#define FND_DIG_MASK        ((unsigned char)(((1 << FND_DIGITS) - 1) << FND_DIG_PIN0))
+#define FND_SEG_XOR         ((FND_SEG_ON) ? 0x00 : 0xFF)    // 버퍼(1 = 켜짐) → 포트 값
+#define FND_DIG_FIRST       ((unsigned char)(1 << FND_DIG_PIN0))
+// 자리 선택은 ISR이 포트 값을 읽어 자리 비트만 바꿔 다시 씁니다(읽기-수정-쓰기). 같은 포트의 나머지 핀(PORTC 4~7, PG4 등)을
+// 메인 루프에서 쓸 때는 cli() ~ SREG 복원 사이에서 써야 합니다. 읽은 뒤 쓰기 전에 ISR이 자리를 바꾸면, 옛 자리 값이 다시 쓰여
+// 다음 인터럽트까지 엉뚱한 자리가 켜집니다. (PORTC의 상수 비트 하나를 sbi/cbi로 바꾸는 것은 명령 하나라 괜찮지만,
+// PORTG는 확장 I/O 영역이라 비트 하나도 lds/sts 세 명령이 됩니다.)
+#if FND_DIG_ON
+#define FND_DIG_OFF()       (FND_DIG_PORT &= (unsigned char)~FND_DIG_MASK)
+#define FND_DIG_SELECT(bit) (FND_DIG_PORT |= (bit))
+#else
+#define FND_DIG_OFF()       (FND_DIG_PORT |= FND_DIG_MASK)
+#define FND_DIG_SELECT(bit) (FND_DIG_PORT &= (unsigned char)~(bit))
+#endif
+// 왼쪽부터 센 자리 pos(0 ~ FND_DIGITS-1)가 몇 번째 자리 선택 핀인지 (스캔 순서 = 핀 순서)
+#define FND_SCAN(pos)       ((FND_ORDER == FND_LEFT_FIRST) ? (pos) : (FND_DIGITS - 1 - (pos)))
+// 표시할 수 있는 가장 큰 10진수
+#if FND_DIGITS >= 5
+#define FND_SHOW_MAX        65535U
+#elif FND_DIGITS == 4
+#define FND_SHOW_MAX        9999U
+#elif FND_DIGITS == 3
+#define FND_SHOW_MAX        999U
+#elif FND_DIGITS == 2
+#define FND_SHOW_MAX        99U
+#else
+#define FND_SHOW_MAX        9U
+#endif
+
+#define FND_REFRESH_HZ      250                         // 기본 화면 갱신 빈도 (4자리에서 자리당 1ms)
+#define FND_REFRESH_MIN     30                          // 이보다 느리면 깜빡임이 보임
+#define FND_REFRESH_MAX     2000                        // 이보다 빠르면 인터럽트 부담만 늘어남
+
+// 글자 번호 (fnd_set_digit()에 0~15 숫자와 함께 사용)
+#define FND_MINUS           16                          // '-'
+#define FND_DOT             17                          // '.'
+#define FND_BLANK           18                          // 꺼짐
+
+#if FND_TIMER == 3
+#define FND_TCCRA           TCCR3A
+#define FND_TCCRB           TCCR3B
+#define FND_TCNT            TCNT3
+#define FND_OCR             OCR3A
+#define FND_OCRB            OCR3B
+#define FND_TIMSK           ETIMSK
+#define FND_TIFR            ETIFR
+#define FND_OCIE            OCIE3A
+#define FND_OCIEB           OCIE3B
+#define FND_OCFB            OCF3B
+#define FND_WGM             (1 << WGM32)                // CTC (TOP = OCR3A)
+#define FND_CLOCK_SELECT    (1 << CS31)                 // Timer3 CS32:CS30 = 010 → clk/8
+#define FND_vect            TIMER3_COMPA_vect
+#define FND_OFF_vect        TIMER3_COMPB_vect
+#else
+#define FND_TCCRA           TCCR1A
+#define FND_TCCRB           TCCR1B
+#define FND_TCNT            TCNT1
+#define FND_OCR             OCR1A
+#define FND_OCRB            OCR1B
+#define FND_TIMSK           TIMSK
+#define FND_TIFR            TIFR
+#define FND_OCIE            OCIE1A
+#define FND_OCIEB           OCIE1B
+#define FND_OCFB            OCF1B
+#define FND_WGM             (1 << WGM12)                // CTC (TOP = OCR1A)
+#define FND_CLOCK_SELECT    (1 << CS11)                 // Timer1 CS12:CS10 = 010 → clk/8
+#define FND_vect            TIMER1_COMPA_vect
+#define FND_OFF_vect        TIMER1_COMPB_vect
+#endif
+
+TIMER_CLAIM(FND_TIMER, fnd)
+
+#ifdef FND_FRAME_HOOK
+void FND_FRAME_HOOK(void);                                  // 다음 화면의 버퍼를 채우는 함수 (인터럽트 금지 상태로 호출)
+#endif
+
+void fnd_init(unsigned int refresh_hz);                     // 포트 설정 후 화면 갱신 시작 (0이면 FND_REFRESH_HZ, sei()는 호출하는 쪽에서)
+unsigned int fnd_refresh_hz(void);                          // 실제 화면 갱신 빈도 (Hz)
+void fnd_show(unsigned int value);                          // 10진수 표시 (FND_SHOW_MAX를 넘으면 "----", 같은 값이면 바로 돌아감)
+unsigned int fnd_show_from(const volatile unsigned int *value); // 인터럽트에서 바뀌는 변수를 한 번에 읽어 표시하고 읽은 값 반환
+void fnd_set_digit(unsigned char pos, unsigned char glyph); // pos 자리(0 = 왼쪽)에 글자 번호 표시
+void fnd_set_raw(unsigned char pos, unsigned char segments);// pos 자리에 세그먼트 패턴 그대로 표시
+unsigned char fnd_glyph(unsigned char glyph);               // 글자 번호 → 세그먼트 패턴 (dp(0x80)를 더해 fnd_set_raw()로 쓸 때)
+void fnd_clear(void);                                       // 모든 자리 끔
+void fnd_begin(void);                                       // 이후의 쓰기를 한 화면으로 묶음 (중첩 가능)
+void fnd_commit(void);                                      // 묶은 화면을 한 번에 내보냄
+void fnd_set_brightness(unsigned char level);               // 전체 밝기 0 ~ 255 (기본 255, 0이면 모두 꺼짐)
+void fnd_set_digit_brightness(unsigned char pos, unsigned char level); // pos 자리의 밝기 0 ~ 255 (기본 255)
+unsigned char fnd_get_brightness(void);                     // 현재 전체 밝기
+
+#endif /* FND_H_ */
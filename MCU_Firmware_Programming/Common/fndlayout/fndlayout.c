@@ -0,0 +1,99 @@
+﻿#include "fndlayout.h"
+
+typedef struct {
+	const volatile unsigned int *source;
+	unsigned char first;
+	unsigned char width;
+	unsigned char format;
+	unsigned char valid;                                    // shown을 그린 적이 있으면 1
+	unsigned int shown;                                     // 마지막으로 그린 값
+} fndlayout_view_t;
+
+static fndlayout_view_t fndlayout_views[FNDLAYOUT_MAX_VIEWS];
+static volatile unsigned char fndlayout_count;              // 등록된 뷰 수 (뷰 내용을 다 채운 뒤 늘림)
+
+// 폭별 10진수 최댓값
+static const unsigned int fndlayout_dec_max[BCD16_DIGITS] PROGMEM = { 9, 99, 999, 9999, 65535 };
+
+// 뷰 추가 함수
+unsigned char fndlayout_add(unsigned char first, unsigned char width, const volatile unsigned int *source, unsigned char format) {
+	unsigned char n = fndlayout_count;
+	fndlayout_view_t *v;
+
+	if (n >= FNDLAYOUT_MAX_VIEWS || width == 0 || first + width > FND_DIGITS || source == 0) {
+		return FNDLAYOUT_NONE;
+	}
+	v = &fndlayout_views[n];
+	v->source = source;
+	v->first = first;
+	v->width = width;
+	v->format = format;
+	v->valid = 0;
+	fndlayout_count = n + 1;                    // ISR은 이 순간부터 새 뷰를 그림
+	return n;
+}
+
+// 뷰 모두 제거 함수
+void fndlayout_clear(void) {
+	fndlayout_count = 0;
+	fnd_clear();
+}
+
+// 뷰 하나 그리기
+static void fndlayout_draw(const fndlayout_view_t *v, unsigned int value) {
+	unsigned char digits[BCD16_DIGITS];
+	unsigned char width = v->width;
+	unsigned char blank = v->format & FNDLAYOUT_BLANK;
+	unsigned char over;
+	unsigned char glyph;
+	unsigned char i;
+
+	if (v->format & FNDLAYOUT_HEX) {
+		over = (width < 4) && (value >> (4 * width));
+	} else {
+		over = (width < BCD16_DIGITS) && (value > pgm_read_word(&fndlayout_dec_max[width - 1]));
+		bcd16(value, digits);
+	}
+	for (i = 0; i < width; i++) {
+		unsigned char place = width - 1 - i;    // 이 자리의 자릿수 (0 = 일의 자리)
+
+		if (over) {
+			glyph = FND_MINUS;
+		} else if (v->format & FNDLAYOUT_HEX) {
+			glyph = (place < 4) ? (unsigned char)((value >> (4 * place)) & 0x0F) : 0;
+		} else {
+			glyph = (place < BCD16_DIGITS) ? digits[BCD16_DIGITS - 1 - place] : 0;
+		}
+		if (blank && glyph == 0 && place != 0) {
+			glyph = FND_BLANK;
+		} else {
+			blank = 0;
+		}
+		fnd_set_digit(v->first + i, glyph);
+	}
+}
+
+// 화면 구성 함수
+// 변수를 읽는 동안만 인터럽트를 막아, 메인 루프에서 불러도 2바이트 값이 반만 바뀐 채 읽히지 않게 합니다.
+void fndlayout_compose(void) {
+	unsigned char n = fndlayout_count;
+	unsigned char i;
+	unsigned char sreg;
+	unsigned int value;
+
+	fnd_begin();                                // 바뀐 뷰를 모두 그린 뒤 한 화면으로 내보냄
+	for (i = 0; i < n; i++) {
+		fndlayout_view_t *v = &fndlayout_views[i];
+
+		sreg = SREG;
+		cli();
+		value = *v->source;
+		SREG = sreg;
+		if (!v->valid || value != v->shown) {
+			fndlayout_draw(v, value);
+			v->shown = value;
+			v->valid = 1;
+		}
+	}
+	fnd_commit();
+}
@@ -0,0 +1,30 @@
+﻿#ifndef FNDLAYOUT_H_
+#define FNDLAYOUT_H_
+
+#include "../fnd/fnd.h"
+
+// FND 화면 나누기 (viewport)
+// 화면을 연속한 자리 묶음(뷰)으로 나누고, 뷰마다 값이 들어 있는 변수와 표시 형식을 묶어 둡니다.
+// fndlayout_compose()가 각 변수를 읽어 바뀐 뷰만 다시 그립니다.
+//   - 프로젝트 심볼에 FND_FRAME_HOOK=fndlayout_compose를 넣으면 fnd 드라이버가 화면을 한 바퀴 돌 때마다
+//     인터럽트 안에서 불러 주므로, 메인 루프는 카운터 변수만 바꾸면 됩니다. (LSegment()/RSegment() 루프 불필요)
+//   - 인터럽트 안에서 읽으므로 다른 ISR이 바꾸는 2바이트 변수도 반만 바뀐 값을 읽지 않습니다.
+//   - FND_FRAME_HOOK을 넣으면 화면 버퍼를 쓰는 쪽은 인터럽트 안의 fndlayout_compose() 하나뿐이어야 합니다. (fnd.h 참고)
+//     메인 루프에서 fndlayout_clear()를 부르거나, 뷰가 덮지 않는 자리를 fnd_set_digit() 등으로 쓰면 두 쪽의 쓰기가 섞입니다.
+//     뷰가 덮지 않는 자리는 꺼진 채로 두고, 표시할 내용이 있으면 그 자리도 뷰로 등록합니다.
+//     (FND_FRAME_HOOK 없이 fndlayout_compose()를 메인 루프에서 직접 부를 때는 같은 루프에서 다른 자리를 써도 됩니다.)
+//   - 자리 수보다 큰 값은 "--"처럼 뷰 전체를 '-'로 표시합니다.
+#define FNDLAYOUT_MAX_VIEWS     4
+#define FNDLAYOUT_NONE          0xFF                    // fndlayout_add() 실패
+
+// 형식 (OR로 조합)
+#define FNDLAYOUT_DEC           0x00                    // 10진수 (0 ~ 10^폭 - 1)
+#define FNDLAYOUT_HEX           0x01                    // 16진수 (0 ~ 16^폭 - 1)
+#define FNDLAYOUT_BLANK         0x02                    // 앞자리 0을 끔 (일의 자리는 항상 표시)
+
+// first: 왼쪽부터 센 첫 자리(0 ~ FND_DIGITS-1), width: 자리 수, source: 표시할 변수
+unsigned char fndlayout_add(unsigned char first, unsigned char width, const volatile unsigned int *source, unsigned char format);
+void fndlayout_clear(void);                             // 모든 뷰 제거 후 화면 끔 (FND_FRAME_HOOK을 쓰면 sei() 전에만)
+void fndlayout_compose(void);                           // 값이 바뀐 뷰를 다시 그림 (FND_FRAME_HOOK이 없으면 직접 호출)
+
+#endif /* FNDLAYOUT_H_ */
@@ -0,0 +1,165 @@
+﻿#include "fndtext.h"
+
+// ASCII 0x20 ~ 0x7F 중 숫자를 뺀 글자 → 세그먼트 패턴 (비트 0~7 = a, b, c, d, e, f, g, dp)
+// 숫자 '0' ~ '9'는 fnd_glyph()의 모양을 그대로 써서 fnd_show()로 그린 숫자와 똑같이 보이게 합니다.
+#define FNDTEXT_DIGIT0      ('0' - 0x20)                    // 숫자 열 칸이 빠지는 자리
+static const unsigned char fndtext_font[96 - 10] PROGMEM = {
+	0x00, 0x86, 0x22, 0x7E, 0x6D, 0xD2, 0x46, 0x20,         //   ! " # $ % & '
+	0x29, 0x0B, 0x21, 0x70, 0x10, 0x40, 0x80, 0x52,         // ( ) * + , - . /
+	0x09, 0x0D, 0x61, 0x48, 0x43, 0xD3,                     // : ; < = > ?
+	0x5F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71, 0x3D,         // @ A B C D E F G
+	0x76, 0x30, 0x1E, 0x75, 0x38, 0x15, 0x37, 0x3F,         // H I J K L M N O
+	0x73, 0x6B, 0x33, 0x6D, 0x78, 0x3E, 0x3E, 0x2A,         // P Q R S T U V W
+	0x76, 0x6E, 0x5B, 0x39, 0x64, 0x0F, 0x23, 0x08,         // X Y Z [ \ ] ^ _
+	0x02, 0x5F, 0x7C, 0x58, 0x5E, 0x7B, 0x71, 0x6F,         // ` a b c d e f g
+	0x74, 0x10, 0x0C, 0x75, 0x30, 0x14, 0x54, 0x5C,         // h i j k l m n o
+	0x73, 0x67, 0x50, 0x6D, 0x78, 0x1C, 0x1C, 0x14,         // p q r s t u v w
+	0x76, 0x6E, 0x5B, 0x46, 0x30, 0x70, 0x01, 0x00          // x y z { | } ~ DEL
+};
+
+static const char *fndtext_text;                            // 스크롤 중인 문자열
+static unsigned char fndtext_flash;                         // fndtext_text가 플래시 주소이면 1
+static unsigned int fndtext_cells;                          // 문자열의 칸 수 ('.' 합친 뒤)
+static unsigned int fndtext_period;                         // 한 바퀴 칸 수 (문자열 + 빈칸 FND_DIGITS개)
+static unsigned int fndtext_pos;                            // 다음에 그릴 창의 첫 칸
+static unsigned char fndtext_loops;                         // 남은 반복 횟수 (0 = 계속)
+static volatile unsigned char fndtext_active;               // 스크롤 중이면 1 (틱 핸들러가 봄)
+
+// 문자 → 세그먼트 패턴 함수
+unsigned char fndtext_glyph(char c) {
+	unsigned char i = (unsigned char)c - 0x20;
+
+	if (i >= FNDTEXT_DIGIT0) {
+		if (i < FNDTEXT_DIGIT0 + 10) {
+			return fnd_glyph(i - FNDTEXT_DIGIT0);
+		}
+		i -= 10;
+	}
+	return (i < sizeof(fndtext_font)) ? pgm_read_byte(&fndtext_font[i]) : 0x00;
+}
+
+// RAM/플래시 문자 읽기
+static char fndtext_read(const char *p, unsigned char flash) {
+	return flash ? (char)pgm_read_byte(p) : *p;
+}
+
+// 한 칸 읽기: 글자 하나(뒤에 '.'이 있으면 dp로 합침)의 패턴을 반환하고 *p를 다음 칸으로 옮김
+static unsigned char fndtext_take(const char **p, unsigned char flash) {
+	char c = fndtext_read(*p, flash);
+	unsigned char seg = fndtext_glyph(c);
+
+	(*p)++;
+	if (c != '.' && fndtext_read(*p, flash) == '.') {
+		seg |= 0x80;
+		(*p)++;
+	}
+	return seg;
+}
+
+// 왼쪽 정렬 그리기
+static void fndtext_draw(const char *text, unsigned char flash) {
+	unsigned char i;
+
+	fndtext_active = 0;
+	fnd_begin();
+	for (i = 0; i < FND_DIGITS; i++) {
+		fnd_set_raw(i, fndtext_read(text, flash) ? fndtext_take(&text, flash) : 0x00);
+	}
+	fnd_commit();
+}
+
+void fndtext_print(const char *text) {
+	fndtext_draw(text, 0);
+}
+
+void fndtext_print_P(const char *text) {
+	fndtext_draw(text, 1);
+}
+
+// 창 그리기: 한 바퀴(문자열 칸 + 빈칸) 중 pos번째 칸부터 FND_DIGITS칸
+// 문자열 칸은 처음 한 번만 앞에서부터 세어 찾고, 이후로는 이어서 읽습니다.
+static void fndtext_render(unsigned int pos) {
+	const char *p = 0;
+	unsigned char i;
+	unsigned int k;
+
+	fnd_begin();                                // 창 전체를 한 화면으로 내보냄 (반만 밀린 글자가 보이지 않게)
+	for (i = 0; i < FND_DIGITS; i++, pos++) {
+		if (pos >= fndtext_period) {
+			pos = 0;
+		}
+		if (pos < fndtext_cells) {
+			if (p == 0 || pos == 0) {
+				p = fndtext_text;
+				for (k = 0; k < pos; k++) {
+					fndtext_take(&p, fndtext_flash);
+				}
+			}
+			fnd_set_raw(i, fndtext_take(&p, fndtext_flash));
+		} else {
+			fnd_set_raw(i, 0x00);
+		}
+	}
+	fnd_commit();
+}
+
+// 스크롤 틱 핸들러 (step_ms마다 틱 인터럽트 안에서 호출)
+// 문자열이 모두 빠져나가 화면이 빈 순간(pos == 칸 수)이 한 바퀴의 끝입니다.
+static void fndtext_step(void) {
+	unsigned int pos;
+
+	if (!fndtext_active) {
+		return;
+	}
+	pos = fndtext_pos;
+	fndtext_render(pos);
+	if (pos == fndtext_cells && fndtext_loops && --fndtext_loops == 0) {
+		fndtext_active = 0;
+		return;
+	}
+	if (++pos >= fndtext_period) {
+		pos = 0;
+	}
+	fndtext_pos = pos;
+}
+
+// 스크롤 시작 (멈춘 상태에서 값을 모두 바꾼 뒤 마지막에 켬)
+static void fndtext_start(const char *text, unsigned char flash, unsigned int step_ms, unsigned char loops) {
+	const char *p = text;
+	unsigned int cells = 0;
+
+	fndtext_active = 0;
+	while (fndtext_read(p, flash)) {
+		fndtext_take(&p, flash);
+		cells++;
+	}
+	fndtext_text = text;
+	fndtext_flash = flash;
+	fndtext_cells = cells;
+	fndtext_period = cells + FND_DIGITS;
+	fndtext_pos = cells + 1;                    // 빈칸 뒤 오른쪽 끝에 첫 글자가 보이는 창부터
+	if (fndtext_pos >= fndtext_period) {
+		fndtext_pos = 0;
+	}
+	fndtext_loops = loops;
+	tick_add_every(fndtext_step, step_ms);      // 이미 등록되어 있으면 주기만 바뀜
+	fndtext_active = 1;
+}
+
+void fndtext_scroll(const char *text, unsigned int step_ms, unsigned char loops) {
+	fndtext_start(text, 0, step_ms, loops);
+}
+
+void fndtext_scroll_P(const char *text, unsigned int step_ms, unsigned char loops) {
+	fndtext_start(text, 1, step_ms, loops);
+}
+
+// 스크롤 멈춤 함수
+void fndtext_stop(void) {
+	fndtext_active = 0;
+}
+
+// 스크롤 여부 함수
+unsigned char fndtext_busy(void) {
+	return fndtext_active;
+}
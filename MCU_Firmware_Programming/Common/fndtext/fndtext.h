@@ -0,0 +1,26 @@
+﻿#ifndef FNDTEXT_H_
+#define FNDTEXT_H_
+
+#include <avr/pgmspace.h>
+#include "../fnd/fnd.h"
+#include "../tick/tick.h"
+
+// FND 문자 표시와 스크롤
+// ASCII 0x20 ~ 0x7F를 7세그먼트 모양으로 바꾸는 표(플래시)로 문자열을 fnd 버퍼에 그립니다.
+//   - 글자 뒤의 '.'은 따로 한 자리를 쓰지 않고 앞 글자의 dp로 합칩니다. ("12.34"는 4자리)
+//   - M, W, X처럼 7세그먼트로 그릴 수 없는 글자는 비슷한 모양으로 대신합니다.
+//   - 자리 수보다 긴 문자열은 1ms 틱(tick 모듈)에서 step_ms마다 한 칸씩 왼쪽으로 흘러가므로 메인 루프를 막지 않습니다.
+//     tick_init()은 호출하는 쪽에서 먼저 해야 하며, 스크롤 중에는 fnd_show() 등으로 같은 화면에 쓰지 않습니다.
+// 스크롤 중인 문자열은 끝날 때까지 그대로 남아 있어야 합니다. (지역 배열 대신 전역/상수 문자열 사용)
+#define FNDTEXT_FOREVER     0   // fndtext_scroll()의 loops: 멈출 때까지 반복
+
+unsigned char fndtext_glyph(char c);                        // 문자 → 세그먼트 패턴 (표에 없으면 0 = 빈칸)
+void fndtext_print(const char *text);                       // 왼쪽부터 그리고 남는 자리는 비움 (넘치는 글자는 잘림, 스크롤 중이면 멈춤)
+void fndtext_print_P(const char *text);                     // 플래시 문자열 (PSTR("Err"))
+// 문자열을 오른쪽에서 들어와 왼쪽으로 빠져나가도록 흘림 (loops번 지나가면 빈 화면으로 멈춤, FNDTEXT_FOREVER면 계속)
+void fndtext_scroll(const char *text, unsigned int step_ms, unsigned char loops);
+void fndtext_scroll_P(const char *text, unsigned int step_ms, unsigned char loops);
+void fndtext_stop(void);                                    // 스크롤 멈춤 (화면은 그대로)
+unsigned char fndtext_busy(void);                           // 스크롤 중이면 1
+
+#endif /* FNDTEXT_H_ */
@@ -0,0 +1,137 @@
+﻿#include <avr/pgmspace.h>
+#include "rgbfade.h"
+#include "gamma16.h" // 감마 2.2 보정표 (밝기 단계 → 16비트 듀티, make -C host tables로 생성)
+
+static unsigned char rgbfade_keys[RGBFADE_MAX_KEYS][3];    // 키프레임 색상 (밝기 단계)
+static int rgbfade_delta[RGBFADE_MAX_KEYS][3];             // 키프레임 i → i + 1 구간의 스텝당 증가량 (8.8)
+static unsigned int rgbfade_level[3];                      // 현재 R, G, B 밝기 단계 (8.8 고정소수점)
+static unsigned char rgbfade_count;                        // 키프레임 개수
+static unsigned char rgbfade_index;                        // 마지막으로 도달한 키프레임
+static unsigned int rgbfade_hold_steps;                    // 키프레임마다 머무는 스텝 수
+static unsigned int rgbfade_fade_steps;                    // 한 구간 보간 스텝 수 (1이면 바로 바뀜)
+static unsigned int rgbfade_hold;                          // 남은 머무름 스텝
+static unsigned int rgbfade_left;                          // 현재 구간의 남은 보간 스텝
+static unsigned char rgbfade_reload;                       // 스텝 1회당 PWM 주기 수
+static unsigned char rgbfade_div;                          // 다음 스텝까지 남은 PWM 주기
+static unsigned char rgbfade_shift;                        // 16비트 감마값 → PWM 듀티 시프트량
+static volatile unsigned char rgbfade_running;             // 인터럽트에서 보간을 진행할지 여부
+
+// 현재 밝기 단계를 감마 보정해 출력
+static void rgbfade_output(void) {
+	rgbpwm_set_raw(pgm_read_word(&gamma16[rgbfade_level[0] >> 8]) >> rgbfade_shift,
+	               pgm_read_word(&gamma16[rgbfade_level[1] >> 8]) >> rgbfade_shift,
+	               pgm_read_word(&gamma16[rgbfade_level[2] >> 8]) >> rgbfade_shift);
+}
+
+// ms → 스텝 수 변환 함수
+static unsigned int rgbfade_steps(unsigned int ms) {
+	return (unsigned int)((unsigned long)ms * rgbfade_step_hz() / 1000);
+}
+
+// PWM 주기 핸들러 (Timer1 오버플로우 인터럽트 안에서 호출)
+static void rgbfade_frame(void) {
+	unsigned char c;
+
+	if (!rgbfade_running || --rgbfade_div) {
+		return;
+	}
+	rgbfade_div = rgbfade_reload;
+
+	if (rgbfade_hold) {
+		rgbfade_hold--;
+		return;
+	}
+	if (--rgbfade_left) {
+		const int *delta = rgbfade_delta[rgbfade_index];
+		for (c = 0; c < 3; c++) {
+			rgbfade_level[c] += delta[c];
+		}
+	} else {
+		// 구간 끝: 누적된 반올림 오차가 남지 않도록 다음 키프레임 값으로 정확히 맞춤
+		if (++rgbfade_index >= rgbfade_count) {
+			rgbfade_index = 0;
+		}
+		for (c = 0; c < 3; c++) {
+			rgbfade_level[c] = (unsigned int)rgbfade_keys[rgbfade_index][c] << 8;
+		}
+		rgbfade_hold = rgbfade_hold_steps;
+		rgbfade_left = rgbfade_fade_steps;
+	}
+	rgbfade_output();
+}
+
+// 크로스페이드 초기화 함수
+void rgbfade_init(void) {
+	unsigned int top;
+
+	rgbfade_running = 0;
+	rgbfade_count = 0;
+	rgbfade_reload = (unsigned char)((rgbpwm_frame_hz() + RGBFADE_STEP_HZ / 2) / RGBFADE_STEP_HZ);
+	if (rgbfade_reload == 0) {
+		rgbfade_reload = 1;
+	}
+	rgbfade_shift = 16;
+	for (top = rgbpwm_top(); top; top >>= 1) {
+		rgbfade_shift--;
+	}
+	rgbpwm_set_frame_handler(rgbfade_frame);
+}
+
+// 실제 보간 빈도 반환 함수
+unsigned int rgbfade_step_hz(void) {
+	return rgbpwm_frame_hz() / rgbfade_reload;
+}
+
+// 키프레임 재생 함수
+void rgbfade_play(const unsigned char (*keys)[3], unsigned char count, unsigned int hold_ms, unsigned int fade_ms) {
+	unsigned char i, c, next;
+
+	rgbfade_running = 0;                    // 설정을 바꾸는 동안 인터럽트가 보간하지 않도록 (1바이트라 원자적)
+	if (count > RGBFADE_MAX_KEYS) {
+		count = RGBFADE_MAX_KEYS;
+	}
+	if (count == 0) {
+		return;
+	}
+
+	rgbfade_count = count;
+	rgbfade_hold_steps = rgbfade_steps(hold_ms);
+	rgbfade_fade_steps = rgbfade_steps(fade_ms);
+	if (rgbfade_fade_steps == 0) {
+		rgbfade_fade_steps = 1;
+	}
+
+	for (i = 0; i < count; i++) {
+		for (c = 0; c < 3; c++) {
+			rgbfade_keys[i][c] = keys[i][c];
+		}
+	}
+	for (i = 0; i < count; i++) {
+		next = (i + 1 < count) ? i + 1 : 0;
+		for (c = 0; c < 3; c++) {
+			long diff = ((long)rgbfade_keys[next][c] - rgbfade_keys[i][c]) << 8;
+			// 증가량은 fade_steps - 1번 더해지므로 목표를 넘지 않음 (마지막 스텝은 키프레임 값으로 맞춤)
+			rgbfade_delta[i][c] = (rgbfade_fade_steps > 1) ? (int)(diff / (long)rgbfade_fade_steps) : 0;
+		}
+	}
+
+	rgbfade_index = 0;
+	for (c = 0; c < 3; c++) {
+		rgbfade_level[c] = (unsigned int)rgbfade_keys[0][c] << 8;
+	}
+	rgbfade_hold = rgbfade_hold_steps;
+	rgbfade_left = rgbfade_fade_steps;
+	rgbfade_div = rgbfade_reload;
+	rgbfade_output();
+	rgbfade_running = (count > 1);
+}
+
+// 재생 정지 함수
+void rgbfade_stop(void) {
+	rgbfade_running = 0;
+}
+
+// 현재 키프레임 번호 반환 함수
+unsigned char rgbfade_key(void) {
+	return rgbfade_index;
+}
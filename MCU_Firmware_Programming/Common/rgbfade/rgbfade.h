@@ -0,0 +1,24 @@
+﻿#ifndef RGBFADE_H_
+#define RGBFADE_H_
+
+#include "../rgbpwm/rgbpwm.h"
+
+// RGB 크로스페이드 서비스
+// 키프레임 색상 사이를 일정한 간격(약 200Hz)으로 보간하면서 rgbpwm 출력으로 내보냅니다.
+//   - 보간은 사람 눈 기준의 밝기 단계(RGB_Table 값, 0 ~ 255)에서 8.8 고정소수점으로 하고,
+//     출력할 때만 감마 2.2 표를 거쳐 PWM 듀티로 바꿉니다. (듀티에서 직선 보간하면 어두운 쪽이 너무 빨리 지나감)
+//   - 구간별 한 스텝 증가량은 rgbfade_play()에서 미리 나눗셈으로 구해 두므로,
+//     Timer1 오버플로우 인터럽트 안에서는 덧셈 3번과 표 조회 3번만 합니다.
+// 듀티 해상도가 높을수록 어두운 구간이 매끄러우므로 rgbpwm_init()을 10비트로 호출하는 것을 권장합니다.
+#define RGBFADE_STEP_HZ     200     // 목표 보간 빈도 (실제 값은 PWM 주기의 정수배 간격으로 맞춤)
+#define RGBFADE_MAX_KEYS    8       // 키프레임 최대 개수
+
+void rgbfade_init(void);    // rgbpwm_init() 다음에 호출 (스텝 간격 계산, PWM 주기 핸들러 등록)
+// keys[0] → keys[1] → ... → keys[count - 1] → keys[0] 순서로 반복합니다.
+// 각 키프레임에서 hold_ms 동안 머문 뒤 fade_ms 동안 다음 키프레임으로 넘어갑니다. (fade_ms = 0이면 바로 바뀜)
+void rgbfade_play(const unsigned char (*keys)[3], unsigned char count, unsigned int hold_ms, unsigned int fade_ms);
+void rgbfade_stop(void);            // 현재 색에서 멈춤
+unsigned char rgbfade_key(void);    // 마지막으로 도달한 키프레임 번호
+unsigned int rgbfade_step_hz(void); // 실제 보간 빈도
+
+#endif /* RGBFADE_H_ */
@@ -0,0 +1,112 @@
+﻿#include "rgbpwm.h"
+
+static unsigned char rgbpwm_bits;                           // PWM 해상도 (8 ~ 10)
+static unsigned char rgbpwm_mode;                           // RGBPWM_PHASE_CORRECT / RGBPWM_FAST
+static volatile rgbpwm_handler_t rgbpwm_frame_handler;      // PWM 주기마다 호출할 함수
+static unsigned int rgbpwm_duty[3];                         // 다음에 반영할 R, G, B 듀티
+static volatile unsigned char rgbpwm_dirty;                 // OCR1x에 아직 쓰지 않은 값이 있는지 여부
+
+// RGB PWM 초기화 함수
+void rgbpwm_init(unsigned char mode, unsigned char bits) {
+	unsigned char wgm;
+
+	if (bits < 8 || bits > 10) {
+		bits = 8;
+	}
+	rgbpwm_bits = bits;
+	rgbpwm_mode = mode;
+	rgbpwm_frame_handler = 0;
+	rgbpwm_duty[0] = 0;
+	rgbpwm_duty[1] = 0;
+	rgbpwm_duty[2] = 0;
+	rgbpwm_dirty = 0;
+
+	RGBPWM_PORT &= ~RGBPWM_PINS;
+	RGBPWM_DDR |= RGBPWM_PINS;
+
+	wgm = bits - 7;                          // WGMn1:n0 = 01(8비트), 10(9비트), 11(10비트)
+	RGBPWM_TCCRB = 0x00;                     // 설정하는 동안 타이머 정지
+	RGBPWM_TCCRA = RGBPWM_COM | wgm;         // 세 채널 비반전 출력
+	RGBPWM_TCCRC = 0x00;
+	RGBPWM_TCNT = 0;
+	RGBPWM_OCRA = 0;
+	RGBPWM_OCRB = 0;
+	RGBPWM_OCRC = 0;
+	RGBPWM_TCCRB = ((mode == RGBPWM_FAST) ? RGBPWM_WGM_FAST : 0) | RGBPWM_CLOCK_SELECT;
+}
+
+// 해상도 TOP 값 반환 함수
+unsigned int rgbpwm_top(void) {
+	return (1U << rgbpwm_bits) - 1;
+}
+
+// PWM 주기 빈도 반환 함수
+// 위상 교정 모드는 0 → TOP → 0을 왕복하므로 한 주기가 2 * TOP tick, 고속 모드는 TOP + 1 tick입니다.
+unsigned int rgbpwm_frame_hz(void) {
+	unsigned long ticks = (rgbpwm_mode == RGBPWM_FAST) ? (unsigned long)rgbpwm_top() + 1 : 2UL * rgbpwm_top();
+
+	return (unsigned int)(F_CPU / 8 / ticks);
+}
+
+// PWM 주기 핸들러 등록 함수
+void rgbpwm_set_frame_handler(rgbpwm_handler_t handler) {
+	RGBPWM_TIMSK &= ~(1 << RGBPWM_TOIE);     // 포인터(2바이트)를 바꾸는 동안 ISR이 읽지 않도록
+	rgbpwm_frame_handler = handler;
+	if (handler || rgbpwm_dirty) {
+		RGBPWM_TIFR = (1 << RGBPWM_TOV);
+		RGBPWM_TIMSK |= (1 << RGBPWM_TOIE);
+	}
+}
+
+// 해상도 그대로의 듀티 설정 함수
+// 세 값을 보관하고 오버플로우 인터럽트를 켭니다. 실제 OCR1x 쓰기는 ISR이 합니다.
+void rgbpwm_set_raw(unsigned int r, unsigned int g, unsigned int b) {
+	unsigned int top = rgbpwm_top();
+
+	rgbpwm_dirty = 0;                         // 값을 바꾸는 동안 ISR이 반만 바뀐 값을 쓰지 않도록 (1바이트라 원자적)
+	rgbpwm_duty[0] = (r > top) ? top : r;
+	rgbpwm_duty[1] = (g > top) ? top : g;
+	rgbpwm_duty[2] = (b > top) ? top : b;
+	rgbpwm_dirty = 1;
+
+	// 예전에 세워진 TOV1 때문에 주기 중간에 ISR이 바로 실행되지 않도록 플래그를 먼저 지움 (1을 써서 클리어)
+	if (!(RGBPWM_TIMSK & (1 << RGBPWM_TOIE))) {
+		RGBPWM_TIFR = (1 << RGBPWM_TOV);
+		RGBPWM_TIMSK |= (1 << RGBPWM_TOIE);
+	}
+}
+
+// 8비트 색 설정 함수
+// 상위 비트를 하위에 다시 채워 0 → 0, 255 → TOP이 되도록 확장합니다.
+void rgbpwm_set(unsigned char r, unsigned char g, unsigned char b) {
+	unsigned char up = rgbpwm_bits - 8;
+	unsigned char down = 16 - rgbpwm_bits;
+
+	rgbpwm_set_raw(((unsigned int)r << up) | (r >> down),
+	               ((unsigned int)g << up) | (g >> down),
+	               ((unsigned int)b << up) | (b >> down));
+}
+
+// 반영 대기 여부 함수
+unsigned char rgbpwm_pending(void) {
+	return rgbpwm_dirty;
+}
+
+// 타이머 오버플로우 인터럽트
+// 고속 PWM은 TOP, 위상 교정 PWM은 BOTTOM에서 들어옵니다. 어느 쪽이든 다음 TOP까지 반 주기 이상 남아 있어
+// 여기서 쓴 세 OCR1x는 같은 TOP에 함께 반영됩니다. 반영할 값도 핸들러도 없으면 인터럽트를 다시 끕니다.
+ISR(RGBPWM_OVF_vect) {
+	rgbpwm_handler_t handler = rgbpwm_frame_handler;
+
+	if (handler) {
+		handler();
+	}
+	if (rgbpwm_dirty) {
+		RGBPWM_OCRA = rgbpwm_duty[0];
+		RGBPWM_OCRB = rgbpwm_duty[1];
+		RGBPWM_OCRC = rgbpwm_duty[2];
+		rgbpwm_dirty = 0;
+	} else if (!handler) {
+		RGBPWM_TIMSK &= ~(1 << RGBPWM_TOIE);
+	}
+}
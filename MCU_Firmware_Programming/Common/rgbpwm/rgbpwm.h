@@ -0,0 +1,78 @@
+﻿#ifndef RGBPWM_H_
+#define RGBPWM_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL // 실습 보드 기본 클럭 (프로젝트에서 먼저 정의하면 그 값을 사용)
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "../timers/timers.h"
+
+// 16비트 타이머 3채널 하드웨어 PWM RGB 드라이버
+// timers.h의 RGBPWM_TIMER에 따라 Timer1(Red = OC1A/PB5, Green = OC1B/PB6, Blue = OC1C/PB7) 또는
+// Timer3(Red = OC3A/PE3, Green = OC3B/PE4, Blue = OC3C/PE5)의 세 비교 출력을 모두 비반전 PWM으로 사용합니다.
+// 아래 설명의 OCR1x, TOV1 등은 Timer3이면 OCR3x, TOV3으로 읽으면 됩니다.
+//   - 출력 파형은 타이머 하드웨어가 만들기 때문에 색을 바꿀 때 말고는 CPU가 관여하지 않습니다.
+//   - 새 색은 rgbpwm_set()이 보관만 하고, 다음 Timer1 오버플로우 인터럽트가 세 OCR1x를 한꺼번에 씁니다.
+//     OCR1x는 PWM 모드에서 TOP에 반영되는 버퍼 레지스터라 세 채널이 항상 같은 주기부터 바뀝니다.
+//     (메인에서 하나씩 쓰면 그 사이에 TOP이 지나가 한 주기 동안 R만 바뀐 색이 나올 수 있음)
+// 분주비는 8로 고정합니다. (16MHz에서 1tick = 0.5us)
+//   위상 교정 8/9/10비트: 3.9kHz / 1.96kHz / 978Hz, 고속 8/9/10비트: 7.8kHz / 3.9kHz / 1.96kHz
+#define RGBPWM_PHASE_CORRECT    0   // 위상 교정 PWM (WGM13:10 = 0001/0010/0011), 밝기 0이면 완전히 꺼짐
+#define RGBPWM_FAST             1   // 고속 PWM (WGM13:10 = 0101/0110/0111), 밝기 0에서도 BOTTOM마다 1tick 켜짐
+#if RGBPWM_TIMER == 1
+#define RGBPWM_TCCRA            TCCR1A
+#define RGBPWM_TCCRB            TCCR1B
+#define RGBPWM_TCCRC            TCCR1C
+#define RGBPWM_TCNT             TCNT1
+#define RGBPWM_OCRA             OCR1A
+#define RGBPWM_OCRB             OCR1B
+#define RGBPWM_OCRC             OCR1C
+#define RGBPWM_TIMSK            TIMSK
+#define RGBPWM_TIFR             TIFR
+#define RGBPWM_TOIE             TOIE1
+#define RGBPWM_TOV              TOV1
+#define RGBPWM_COM              ((1 << COM1A1) | (1 << COM1B1) | (1 << COM1C1))
+#define RGBPWM_WGM_FAST         (1 << WGM12)
+#define RGBPWM_CLOCK_SELECT     (1 << CS11)    // Timer1 CS12:CS10 = 010 → clk/8
+#define RGBPWM_PORT             PORTB
+#define RGBPWM_DDR              DDRB
+#define RGBPWM_PINS             ((1 << PB5) | (1 << PB6) | (1 << PB7))
+#define RGBPWM_OVF_vect         TIMER1_OVF_vect
+#else
+#define RGBPWM_TCCRA            TCCR3A
+#define RGBPWM_TCCRB            TCCR3B
+#define RGBPWM_TCCRC            TCCR3C
+#define RGBPWM_TCNT             TCNT3
+#define RGBPWM_OCRA             OCR3A
+#define RGBPWM_OCRB             OCR3B
+#define RGBPWM_OCRC             OCR3C
+#define RGBPWM_TIMSK            ETIMSK
+#define RGBPWM_TIFR             ETIFR
+#define RGBPWM_TOIE             TOIE3
+#define RGBPWM_TOV              TOV3
+#define RGBPWM_COM              ((1 << COM3A1) | (1 << COM3B1) | (1 << COM3C1))
+#define RGBPWM_WGM_FAST         (1 << WGM32)
+#define RGBPWM_CLOCK_SELECT     (1 << CS31)    // Timer3 CS32:CS30 = 010 → clk/8
+#define RGBPWM_PORT             PORTE
+#define RGBPWM_DDR              DDRE
+#define RGBPWM_PINS             ((1 << PE3) | (1 << PE4) | (1 << PE5))
+#define RGBPWM_OVF_vect         TIMER3_OVF_vect
+#endif
+
+TIMER_CLAIM(RGBPWM_TIMER, rgbpwm)
+
+typedef void (*rgbpwm_handler_t)(void);
+
+void rgbpwm_init(unsigned char mode, unsigned char bits);   // bits = 8, 9, 10 (그 외는 8), RGBPWM_PINS를 출력으로 설정
+void rgbpwm_set(unsigned char r, unsigned char g, unsigned char b);  // 8비트 색 (255 = TOP으로 확장)
+void rgbpwm_set_raw(unsigned int r, unsigned int g, unsigned int b); // 해상도 그대로의 듀티 (0 ~ TOP)
+unsigned int rgbpwm_top(void);                              // 현재 해상도의 TOP (255 / 511 / 1023)
+unsigned char rgbpwm_pending(void);                         // 아직 출력에 반영되지 않은 색이 있으면 1
+unsigned int rgbpwm_frame_hz(void);                         // 타이머 오버플로우(PWM 주기) 횟수/초
+// PWM 주기마다(오버플로우 인터럽트 안에서) 호출할 함수 등록 (NULL이면 해제)
+// 핸들러가 rgbpwm_set()/rgbpwm_set_raw()를 부르면 그 색은 같은 인터럽트에서 바로 OCR1x에 쓰입니다.
+void rgbpwm_set_frame_handler(rgbpwm_handler_t handler);
+
+#endif /* RGBPWM_H_ */
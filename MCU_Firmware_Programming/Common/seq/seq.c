@@ -0,0 +1,111 @@
+﻿#include "seq.h"
+
+static seq_player_t *seq_players[SEQ_MAX_PLAYERS];     // 틱마다 진행할 재생기
+static volatile unsigned char seq_player_count;
+
+// 패턴 정보를 플래시에서 읽어 처음부터 재생하도록 준비
+static void seq_load(seq_player_t *p, const seq_pattern_t *pattern) {
+	memcpy_P(&p->pattern, pattern, sizeof(seq_pattern_t));
+	if (p->pattern.frame_ms == 0) {
+		p->pattern.frame_ms = 1;
+	}
+	p->pc = p->pattern.frames;
+	p->left = 0;
+	p->loops_left = p->pattern.loops;
+}
+
+// 다음 프레임 계산 후 출력
+// 현재 명령의 프레임을 다 쓰면 다음 명령을 읽고, SEQ_END에서는 반복하거나 다음 패턴으로 넘어갑니다.
+static void seq_frame(seq_player_t *p) {
+	unsigned char ends = 0;
+
+	while (p->left == 0) {
+		unsigned char cmd = pgm_read_byte(p->pc++);
+
+		if ((cmd & SEQ_OP_MASK) == SEQ_OP_END) {
+			// 프레임 없이 END만 연달아 만나면 (빈 패턴끼리 연결 등) 인터럽트 안에서 계속 돌지 않도록 멈춤
+			if (++ends > 2) {
+				p->running = 0;
+				return;
+			}
+			if (p->pattern.loops == 0 || --p->loops_left) {
+				p->pc = p->pattern.frames;
+			} else if (p->pattern.next) {
+				seq_load(p, p->pattern.next);
+			} else {
+				p->running = 0;         // 마지막 프레임을 유지한 채 종료
+				return;
+			}
+			continue;
+		}
+		p->op = cmd & SEQ_OP_MASK;
+		p->left = (cmd & ~SEQ_OP_MASK) + 1;
+		if (p->op == SEQ_OP_SET || p->op == SEQ_OP_XOR) {
+			p->arg = pgm_read_byte(p->pc++);
+		}
+	}
+
+	switch (p->op) {
+	case SEQ_OP_SET: p->value = p->arg; break;
+	case SEQ_OP_XOR: p->value ^= p->arg; break;
+	case SEQ_OP_ROL: p->value = (unsigned char)((p->value << 1) | (p->value >> 7)); break;
+	case SEQ_OP_ROR: p->value = (unsigned char)((p->value >> 1) | (p->value << 7)); break;
+	case SEQ_OP_SHL: p->value <<= 1; break;
+	case SEQ_OP_SHR: p->value >>= 1; break;
+	default: break;                     // SEQ_OP_HOLD
+	}
+	p->left--;
+	*p->port = p->value;
+}
+
+// 1ms 틱 핸들러: 재생기마다 프레임 간격이 지나면 한 프레임 진행
+static void seq_tick(void) {
+	unsigned char i;
+
+	for (i = 0; i < seq_player_count; i++) {
+		seq_player_t *p = seq_players[i];
+
+		if (p->running && --p->wait == 0) {
+			seq_frame(p);
+			p->wait = p->pattern.frame_ms;  // 다음 패턴으로 넘어갔으면 그 패턴의 간격
+		}
+	}
+}
+
+// 시퀀서 초기화 함수
+void seq_init(void) {
+	seq_player_count = 0;
+	tick_add(seq_tick);
+}
+
+// 재생 시작 함수
+void seq_start(seq_player_t *player, volatile unsigned char *port, const seq_pattern_t *pattern) {
+	unsigned char i;
+
+	player->running = 0;                // 준비하는 동안 틱 핸들러가 진행하지 않도록 (1바이트라 원자적)
+	player->port = port;
+	player->value = 0;
+	player->wait = 1;
+	seq_load(player, pattern);
+
+	for (i = 0; i < seq_player_count && seq_players[i] != player; i++) {
+	}
+	if (i == seq_player_count) {
+		if (i >= SEQ_MAX_PLAYERS) {
+			return;                     // 자리가 없으면 재생하지 않음
+		}
+		seq_players[i] = player;        // 자리를 먼저 채운 뒤 개수를 늘림
+		seq_player_count = i + 1;
+	}
+	player->running = 1;
+}
+
+// 재생 정지 함수
+void seq_stop(seq_player_t *player) {
+	player->running = 0;
+}
+
+// 재생 여부 함수
+unsigned char seq_busy(const seq_player_t *player) {
+	return player->running;
+}
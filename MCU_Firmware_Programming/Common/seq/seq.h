@@ -0,0 +1,65 @@
+﻿#ifndef SEQ_H_
+#define SEQ_H_
+
+#include <avr/pgmspace.h>
+#include "../tick/tick.h"
+
+// 플래시 패턴 시퀀서
+// 8비트 포트에 내보낼 프레임들을 "명령 바이트열"로 플래시(PROGMEM)에 두고, 1ms 틱 인터럽트에서 재생합니다.
+//   - 명령 1바이트 = 종류(상위 3비트) + 반복 횟수 - 1(하위 5비트, 1 ~ 32프레임)
+//   - SET/XOR만 값 1바이트가 뒤따르고, 나머지는 명령 1바이트로 여러 프레임을 만듭니다.
+//     예) 한 칸씩 이동하는 8프레임 = SEQ_SET(0x01, 1), SEQ_ROL(7), SEQ_END → 4바이트
+//   - 패턴마다 프레임 간격, 반복 횟수, 끝난 뒤 이어서 재생할 패턴을 정합니다.
+// 포트 쓰기는 인터럽트에서 하므로 메인 루프는 막히지 않습니다.
+#define SEQ_OP_SET      0x00    // 값 출력 (n프레임 유지) - 런 렝스
+#define SEQ_OP_XOR      0x20    // 이전 값에 마스크 XOR (프레임마다, n번) - 델타, 깜빡임
+#define SEQ_OP_ROL      0x40    // 왼쪽으로 1비트 회전 (프레임마다, n번)
+#define SEQ_OP_ROR      0x60    // 오른쪽으로 1비트 회전
+#define SEQ_OP_SHL      0x80    // 왼쪽으로 1비트 시프트 (밀려난 비트는 사라지고 0이 들어옴)
+#define SEQ_OP_SHR      0xA0    // 오른쪽으로 1비트 시프트
+#define SEQ_OP_HOLD     0xC0    // 값 그대로 n프레임 유지
+#define SEQ_OP_END      0xE0    // 패턴 끝 (반복 또는 다음 패턴으로)
+#define SEQ_OP_MASK     0xE0
+#define SEQ_MAX_RUN     32
+
+#define SEQ_RUN(n)          (((n) - 1) & 0x1F)
+#define SEQ_SET(value, n)   (SEQ_OP_SET | SEQ_RUN(n)), (value)
+#define SEQ_XOR(mask, n)    (SEQ_OP_XOR | SEQ_RUN(n)), (mask)
+#define SEQ_ROL(n)          (SEQ_OP_ROL | SEQ_RUN(n))
+#define SEQ_ROR(n)          (SEQ_OP_ROR | SEQ_RUN(n))
+#define SEQ_SHL(n)          (SEQ_OP_SHL | SEQ_RUN(n))
+#define SEQ_SHR(n)          (SEQ_OP_SHR | SEQ_RUN(n))
+#define SEQ_HOLD(n)         (SEQ_OP_HOLD | SEQ_RUN(n))
+#define SEQ_END             SEQ_OP_END
+
+#define SEQ_MAX_PLAYERS 4       // 동시에 재생할 수 있는 포트 수
+
+// 패턴 정보 (PROGMEM에 두고 주소를 넘김)
+typedef struct seq_pattern {
+	const unsigned char *frames;        // 명령 바이트열 (PROGMEM)
+	unsigned int frame_ms;              // 프레임 간격 (ms, 1 이상)
+	unsigned char loops;                // 재생 횟수 (0 = 무한 반복)
+	const struct seq_pattern *next;     // 다 재생한 뒤 이어서 재생할 패턴 (PROGMEM, NULL이면 마지막 프레임에서 멈춤)
+} seq_pattern_t;
+
+// 재생기 (포트 하나당 하나, 전역/정적 변수로 둠)
+typedef struct {
+	volatile unsigned char *port;       // 출력 포트
+	seq_pattern_t pattern;              // 재생 중인 패턴 (플래시에서 복사)
+	const unsigned char *pc;            // 다음에 읽을 명령 위치 (PROGMEM)
+	unsigned char op;                   // 현재 명령 종류
+	unsigned char arg;                  // SET 값 / XOR 마스크
+	unsigned char left;                 // 현재 명령의 남은 프레임
+	unsigned char value;                // 현재 출력 값
+	unsigned char loops_left;           // 남은 재생 횟수
+	unsigned int wait;                  // 다음 프레임까지 남은 ms
+	volatile unsigned char running;
+} seq_player_t;
+
+void seq_init(void);    // tick_init() 다음에 호출 (틱 핸들러 등록)
+// player로 port에 pattern을 처음부터 재생 (재생 중이던 패턴은 바로 중단, 첫 프레임은 다음 틱에 출력)
+void seq_start(seq_player_t *player, volatile unsigned char *port, const seq_pattern_t *pattern);
+void seq_stop(seq_player_t *player);                // 현재 프레임에서 멈춤
+unsigned char seq_busy(const seq_player_t *player); // 재생 중이면 1
+
+#endif /* SEQ_H_ */
@@ -0,0 +1,127 @@
+﻿#include "stopwatch.h"
+
+// 초기화 함수
+void stopwatch_reset(stopwatch_t *sw) {
+	sw->start = tick_millis();
+	sw->total = 0;
+	sw->lap = 0;
+	sw->running = 0;
+	sw->lapped = 0;
+	sw->valid = 0;
+}
+
+// 시작 함수
+void stopwatch_start(stopwatch_t *sw) {
+	if (!sw->running) {
+		sw->start = tick_millis();
+		sw->running = 1;
+	}
+}
+
+// 정지 함수 (이번 구간을 누적에 더함)
+void stopwatch_stop(stopwatch_t *sw) {
+	if (sw->running) {
+		sw->total += tick_millis() - sw->start;
+		sw->running = 0;
+	}
+}
+
+// 경과 시간 함수
+// tick_millis()가 한 바퀴 돌아도 뺄셈은 unsigned 나머지 연산이라 구간 길이는 그대로 나옵니다.
+unsigned long stopwatch_elapsed(const stopwatch_t *sw) {
+	if (sw->running) {
+		return sw->total + (tick_millis() - sw->start);
+	}
+	return sw->total;
+}
+
+// 랩 함수
+unsigned long stopwatch_lap(stopwatch_t *sw) {
+	sw->lap = stopwatch_elapsed(sw);
+	sw->lapped = 1;
+	return sw->lap;
+}
+
+// 랩 해제 함수
+void stopwatch_lap_clear(stopwatch_t *sw) {
+	sw->lapped = 0;
+}
+
+// 두 필드를 4자리 값으로 (앞 필드는 100에서 0으로 돌아감)
+static unsigned int stopwatch_pair(unsigned long high, unsigned char low) {
+	return (unsigned int)(high % 100) * 100 + low;
+}
+
+// 표시 함수
+// 지난번에 그린 값이 보이는 구간(shown_from부터 shown_span ms) 안이면 뺄셈 한 번으로 돌아가고,
+// 나눗셈은 구간을 벗어나 값을 새로 구할 때만 합니다. (1ms마다 불러도 1/100초 형식은 10번에 한 번)
+void stopwatch_show(stopwatch_t *sw, unsigned char format) {
+	unsigned long ms = sw->lapped ? sw->lap : stopwatch_elapsed(sw);
+	unsigned long t;
+	unsigned char digits[BCD16_DIGITS];
+	unsigned char dp = 1;                       // 두 번째 자리 dp를 구분점으로
+	unsigned char mode = format;
+	unsigned int value;
+	unsigned int span;
+	unsigned char i;
+	unsigned char glyph;
+
+	// 랩 고정/해제나 리셋으로 시간이 뒤로 가도 unsigned 뺄셈이라 구간 밖으로 나옵니다.
+	if (sw->valid && format == sw->shown_mode && ms - sw->shown_from < sw->shown_span) {
+		return;
+	}
+
+	if (format == STOPWATCH_AUTO) {
+		if (ms < 60000UL) {
+			format = STOPWATCH_SS_HH;
+		} else if (ms < 6000000UL) {
+			format = STOPWATCH_MM_SS;
+		} else {
+			format = STOPWATCH_HH_MM;
+		}
+	}
+	switch (format) {
+	case STOPWATCH_SS_HH:
+		span = 10;
+		t = ms / 10;                            // 1/100초
+		value = stopwatch_pair(t / 100, (unsigned char)(t % 100));
+		break;
+	case STOPWATCH_MM_SS:
+		span = 1000;
+		t = ms / 1000;                          // 초
+		value = stopwatch_pair(t / 60, (unsigned char)(t % 60));
+		break;
+	case STOPWATCH_HH_MM:
+		span = 60000U;
+		t = ms / 60000UL;                       // 분
+		value = stopwatch_pair(t / 60, (unsigned char)(t % 60));
+		break;
+	default:
+		span = 1000;
+		t = ms / 1000;
+		value = (unsigned int)(t % 10000);
+		dp = 0xFF;                              // 구분점 없음
+		break;
+	}
+	// AUTO의 형식 경계(1분, 100분)도 한 칸의 배수라서 구간 안에서는 형식이 바뀌지 않습니다.
+	sw->shown_from = t * span;
+	sw->shown_span = span;
+	sw->shown_mode = mode;
+	sw->valid = 1;
+
+	bcd16(value, digits);                       // 만의 자리는 항상 0
+	fnd_begin();
+#if FND_DIGITS > 4
+	for (i = 0; i < FND_DIGITS - 4; i++) {
+		fnd_set_digit(i, FND_BLANK);
+	}
+#endif
+	for (i = 0; i < 4; i++) {
+		glyph = digits[i + 1];
+		if (i == 0 && glyph == 0 && dp == 1) {
+			glyph = FND_BLANK;                  // " 5.23" (초 카운터는 fnd_show()처럼 0을 그대로 표시)
+		}
+		fnd_set_raw(FND_DIGITS - 4 + i, fnd_glyph(glyph) | ((i == dp) ? 0x80 : 0x00));
+	}
+	fnd_commit();
+}
@@ -0,0 +1,50 @@
+﻿#ifndef STOPWATCH_H_
+#define STOPWATCH_H_
+
+#include "../tick/tick.h"
+#include "../fnd/fnd.h"
+
+// 스톱워치 / 초 카운터
+// 타이머 오버플로 횟수를 직접 세지 않고, 시작/정지 순간의 tick_millis()만 기록해 경과 시간을 계산합니다.
+//   - 틱은 CTC 주기에 소수 보정을 더해 평균 1ms이므로(tick.h) 몇 시간을 재도 수정 발진자 오차만큼만 어긋납니다.
+//   - 재는 동안 인터럽트 안에서 하는 일이 없고, 여러 개를 동시에 돌려도 타이머를 더 쓰지 않습니다.
+//   - 경과 시간은 ms 단위 unsigned long이라 약 49일까지 잴 수 있습니다.
+// tick_init()은 호출하는 쪽에서 먼저 하며, 함수들은 모두 메인 루프에서 부릅니다.
+//
+// FND 표시 형식 (오른쪽 4자리, 구분점은 ':' 대신 두 번째 자리의 dp, 구분점이 있으면 맨 앞자리 0은 비움)
+//   STOPWATCH_SS_HH     초.1/100초   " 5.23" (100초마다 0으로)
+//   STOPWATCH_MM_SS     분.초        "12.05" (100분마다 0으로)
+//   STOPWATCH_HH_MM     시.분        " 3.41" (100시간마다 0으로)
+//   STOPWATCH_AUTO      1분 전에는 초.1/100초, 100분 전에는 분.초, 그 뒤로는 시.분
+//   STOPWATCH_SECONDS   경과 초 "0042" (10000초마다 0으로, 초 카운터)
+#define STOPWATCH_SS_HH     0
+#define STOPWATCH_MM_SS     1
+#define STOPWATCH_HH_MM     2
+#define STOPWATCH_AUTO      3
+#define STOPWATCH_SECONDS   4
+
+#if FND_DIGITS < 4
+#error "stopwatch needs FND_DIGITS >= 4"
+#endif
+
+typedef struct {
+	unsigned long start;        // 마지막으로 시작한 시각 (tick_millis)
+	unsigned long total;        // 앞서 멈춘 구간까지의 경과 시간 (ms)
+	unsigned long lap;          // 고정해 둔 랩 시간 (ms)
+	unsigned char running;      // 재는 중이면 1
+	unsigned char lapped;       // 랩 시간을 표시 중이면 1
+	unsigned char valid;        // 0이면 다음 stopwatch_show()가 화면을 다시 그림 (화면을 다른 용도로 썼을 때 0으로)
+	unsigned char shown_mode;   // 마지막으로 그린 형식 (stopwatch_show()에 넘긴 값 그대로)
+	unsigned int shown_span;    // 보이는 값 한 칸의 길이 (ms, 10 / 1000 / 60000)
+	unsigned long shown_from;   // 마지막으로 그린 값이 시작되는 시각 (경과 ms, shown_span의 배수)
+} stopwatch_t;
+
+void stopwatch_reset(stopwatch_t *sw);                      // 0으로 되돌리고 멈춤 (랩 표시도 풂)
+void stopwatch_start(stopwatch_t *sw);                      // 재기 시작 (멈춘 시간부터 이어서)
+void stopwatch_stop(stopwatch_t *sw);                       // 멈춤
+unsigned long stopwatch_elapsed(const stopwatch_t *sw);     // 경과 시간 (ms)
+unsigned long stopwatch_lap(stopwatch_t *sw);               // 지금 시간을 랩으로 고정해 표시 (계속 잼), 랩 시간 반환
+void stopwatch_lap_clear(stopwatch_t *sw);                  // 랩 표시를 풀고 흐르는 시간을 다시 표시
+void stopwatch_show(stopwatch_t *sw, unsigned char format); // FND에 표시 (보이는 값이 바뀔 때만 다시 그림)
+
+#endif /* STOPWATCH_H_ */
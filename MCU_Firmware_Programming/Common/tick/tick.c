@@ -0,0 +1,91 @@
+﻿#include "tick.h"
+
+static volatile unsigned long tick_count;                   // 1ms 틱 카운터
+static tick_handler_t tick_handlers[TICK_MAX_HANDLERS];     // 등록된 핸들러
+static unsigned int tick_periods[TICK_MAX_HANDLERS];        // 핸들러별 호출 주기 (ms)
+static unsigned int tick_waits[TICK_MAX_HANDLERS];          // 핸들러별 다음 호출까지 남은 틱
+static volatile unsigned char tick_handler_count;           // 등록된 핸들러 수
+#if TICK_FRAC
+static unsigned int tick_frac;                              // 누적된 소수 카운트 (1000 = 1카운트, ISR 전용)
+#endif
+
+// 틱 초기화 함수
+void tick_init(void) {
+	tick_count = 0;
+	tick_handler_count = 0;
+#if TICK_FRAC
+	tick_frac = 0;
+#endif
+	TICK_TCCR = TICK_WGM | TICK_CLOCK_SELECT; // CTC 모드 (TOP = OCR), clk/64
+	TICK_OCR = TICK_OCR_VALUE;
+	TICK_TCNT = 0;
+	TIMSK |= (1 << TICK_OCIE);                // 비교 일치 인터럽트 허용
+}
+
+// 매 틱 핸들러 등록 함수
+unsigned char tick_add(tick_handler_t handler) {
+	return tick_add_every(handler, 1);
+}
+
+// 주기 핸들러 등록 함수
+// 새 자리는 먼저 채운 뒤 개수를 늘리므로(1바이트라 원자적) ISR은 다 쓴 자리만 봅니다.
+unsigned char tick_add_every(tick_handler_t handler, unsigned int period_ms) {
+	unsigned char i;
+	unsigned char sreg;
+
+	if (period_ms == 0) {
+		period_ms = 1;
+	}
+	for (i = 0; i < tick_handler_count; i++) {
+		if (tick_handlers[i] == handler) {
+			sreg = SREG;
+			cli(); // 2바이트 값 두 개를 ISR이 읽는 도중에 바꾸지 않도록
+			tick_periods[i] = period_ms;
+			tick_waits[i] = period_ms;
+			SREG = sreg;
+			return 1;
+		}
+	}
+	if (tick_handler_count >= TICK_MAX_HANDLERS) {
+		return 0;
+	}
+	tick_handlers[i] = handler;
+	tick_periods[i] = period_ms;
+	tick_waits[i] = period_ms;
+	tick_handler_count = i + 1;
+	return 1;
+}
+
+// 경과 시간 읽기 함수 (4바이트라 읽는 동안 인터럽트를 막음)
+unsigned long tick_millis(void) {
+	unsigned long ms;
+	unsigned char sreg = SREG;
+
+	cli();
+	ms = tick_count;
+	SREG = sreg;
+	return ms;
+}
+
+// 1ms 틱 인터럽트: 주기가 된 핸들러만 호출
+// CTC에서는 OCR이 바로 바뀌므로, 방금 0부터 다시 세기 시작한 이번 주기의 길이를 여기서 정합니다.
+ISR(TICK_vect) {
+	unsigned char i;
+
+#if TICK_FRAC
+	tick_frac += TICK_FRAC;
+	if (tick_frac >= 1000) {
+		tick_frac -= 1000;
+		TICK_OCR = TICK_OCR_VALUE + 1;          // 쌓인 소수가 1카운트가 되면 한 카운트 긴 주기
+	} else {
+		TICK_OCR = TICK_OCR_VALUE;
+	}
+#endif
+	tick_count++;
+	for (i = 0; i < tick_handler_count; i++) {
+		if (--tick_waits[i] == 0) {
+			tick_waits[i] = tick_periods[i];
+			tick_handlers[i]();
+		}
+	}
+}
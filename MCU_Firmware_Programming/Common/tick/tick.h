@@ -0,0 +1,51 @@
+﻿#ifndef TICK_H_
+#define TICK_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL // 실습 보드 기본 클럭 (프로젝트에서 먼저 정의하면 그 값을 사용)
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "../timers/timers.h"
+
+// 1ms 틱 스케줄러
+// 8비트 타이머(timers.h의 TICK_TIMER, 기본 Timer0)를 CTC 모드, 64분주로 돌려 1ms마다 비교 일치 인터럽트를 만들고,
+// 등록된 핸들러를 각자의 주기마다 호출합니다. 주기가 다른 일들도 타이머 하나를 나눠 씁니다.
+// 1ms가 정수 카운트로 나누어떨어지지 않으면, 남는 소수(TICK_FRAC / 1000카운트)를 틱마다 누적해 넘칠 때만
+// 한 카운트 긴 주기를 넣으므로(Bresenham 방식) 긴 시간 평균은 수정 발진자 오차만큼 정확합니다.
+// 16MHz에서는 250카운트로 정확히 1ms, 14.7456MHz에서는 230카운트 3번과 231카운트 2번을 섞어 평균 1ms입니다.
+// (틱 하나의 길이는 최대 1카운트(4.3us) 흔들리고, 5틱마다 오차가 0으로 돌아옴)
+// 핸들러는 인터럽트 안에서 실행되므로 짧게 끝나야 합니다. (_delay_ms() 금지)
+#if TICK_TIMER == 0
+#define TICK_TCCR           TCCR0
+#define TICK_OCR            OCR0
+#define TICK_TCNT           TCNT0
+#define TICK_OCIE           OCIE0
+#define TICK_WGM            (1 << WGM01)
+#define TICK_CLOCK_SELECT   (1 << CS02)                     // Timer0 CS02:CS00 = 100 → clk/64
+#define TICK_vect           TIMER0_COMP_vect
+#else
+#define TICK_TCCR           TCCR2
+#define TICK_OCR            OCR2
+#define TICK_TCNT           TCNT2
+#define TICK_OCIE           OCIE2
+#define TICK_WGM            (1 << WGM21)
+#define TICK_CLOCK_SELECT   ((1 << CS21) | (1 << CS20))     // Timer2 CS22:CS20 = 011 → clk/64
+#define TICK_vect           TIMER2_COMP_vect
+#endif
+#define TICK_OCR_VALUE      (F_CPU / 64 / 1000 - 1)         // 1ms를 넘지 않는 가장 긴 정수 카운트 - 1
+#define TICK_FRAC           (F_CPU / 64 % 1000)             // 1초 동안 남는 카운트 수 (0이면 보정 없음)
+#define TICK_MAX_HANDLERS   4                               // 등록할 수 있는 핸들러 수
+
+TIMER_CLAIM(TICK_TIMER, tick)
+
+typedef void (*tick_handler_t)(void);
+
+void tick_init(void);                           // 1ms 틱 시작 (sei()는 호출하는 쪽에서)
+unsigned char tick_add(tick_handler_t handler); // 매 틱 호출할 함수 등록 (tick_add_every(handler, 1)과 같음)
+// period_ms마다 호출할 함수 등록 (이미 등록된 함수면 주기만 바꿈, 자리가 없으면 0 반환)
+unsigned char tick_add_every(tick_handler_t handler, unsigned int period_ms);
+unsigned long tick_millis(void);                // 틱 시작 후 경과 시간 (ms)
+
+#endif /* TICK_H_ */
@@ -0,0 +1,72 @@
+﻿#ifndef TIMERS_H_
+#define TIMERS_H_
+
+// 타이머 배정표
+// 공용 모듈이 쓰는 타이머를 필요한 기능(8/16비트, 비교 출력 핀, 입력 캡처)에 맞춰 이 파일 한 곳에서 정합니다.
+// 배정은 프로젝트 전체에 같은 값으로 적용되는 심볼(Project Properties > Symbols, -D)만 보고 결정하므로
+// 어느 .c 파일에서 포함하든 같은 타이머와 같은 인터럽트 벡터가 선택됩니다.
+//
+//   타이머  비트  비교 출력 핀                    입력 캡처    공용 모듈 후보
+//   Timer0  8     OC0(PB4)                        -            tick, bam (CTC 주기 인터럽트)
+//   Timer1  16    OC1A/B/C(PB5/PB6/PB7)           ICP1(PD4)    rgbpwm, fnd (CTC 주기 인터럽트)
+//   Timer2  8     OC2(PB7, OC1C와 같은 핀)        -            tick, bam (CTC 주기 인터럽트)
+//   Timer3  16    OC3A/B/C(PE3/PE4/PE5)           ICP3(PE7)    rgbpwm, fnd (CTC 주기 인터럽트)
+//
+// 같은 주기로 돌아야 하는 일(초 카운터, 키 스캔, 패턴 재생 등)은 타이머를 따로 잡지 말고
+// tick 모듈의 핸들러(tick_add(), tick_add_every())로 Timer 하나에 모아 실행합니다.
+//
+// 각 모듈 헤더는 배정된 타이머를 TIMER_CLAIM()으로 차지합니다. 두 모듈이 같은 타이머를 차지한 채
+// 한 파일(보통 main.c)에 함께 포함되면 "redeclaration of enumerator 'timer_owner_T2'" 오류로 빌드가 실패합니다.
+
+// ---- 8비트 주기 타이머: tick, bam ----
+// 둘 중 하나만 지정하면 다른 쪽이 남은 8비트 타이머를 씁니다. (기본: tick = Timer0, bam = Timer2)
+#if !defined(TICK_TIMER) && !defined(BAM_TIMER)
+#define TICK_TIMER  0
+#define BAM_TIMER   2
+#elif !defined(BAM_TIMER)
+#if TICK_TIMER == 2
+#define BAM_TIMER   0
+#else
+#define BAM_TIMER   2
+#endif
+#elif !defined(TICK_TIMER)
+#if BAM_TIMER == 0
+#define TICK_TIMER  2
+#else
+#define TICK_TIMER  0
+#endif
+#endif
+#if TICK_TIMER != 0 && TICK_TIMER != 2
+#error "TICK_TIMER must be 0 or 2 (8-bit timer with CTC)"
+#endif
+#if BAM_TIMER != 0 && BAM_TIMER != 2
+#error "BAM_TIMER must be 0 or 2 (8-bit timer with CTC)"
+#endif
+
+// ---- 16비트 3채널 PWM 타이머: rgbpwm ----
+// RGB LED를 어느 비교 출력 핀에 연결했는지에 따라 정합니다. (기본: Timer1, PB5~PB7)
+#ifndef RGBPWM_TIMER
+#define RGBPWM_TIMER 1
+#endif
+#if RGBPWM_TIMER != 1 && RGBPWM_TIMER != 3
+#error "RGBPWM_TIMER must be 1 (OC1A~C, PB5~PB7) or 3 (OC3A~C, PE3~PE5)"
+#endif
+
+// ---- 16비트 CTC 주기 타이머: fnd ----
+// 비교 출력 핀을 쓰지 않으므로 rgbpwm이 쓰지 않는 16비트 타이머를 받습니다. (기본: Timer3)
+#ifndef FND_TIMER
+#if RGBPWM_TIMER == 3
+#define FND_TIMER   1
+#else
+#define FND_TIMER   3
+#endif
+#endif
+#if FND_TIMER != 1 && FND_TIMER != 3
+#error "FND_TIMER must be 1 or 3 (16-bit timer with CTC)"
+#endif
+
+// 타이머 차지 (TIMER_CLAIM(2, bam) → timer_owner_T2, n이 매크로여도 숫자로 펼친 뒤 이어 붙이므로 배정 값은 숫자 하나로 정의)
+#define TIMER_CLAIM(n, owner)   TIMER_CLAIM_(n, owner)
+#define TIMER_CLAIM_(n, owner)  enum { timer_owner_T##n = 0, timer_T##n##_##owner = 0 };
+
+#endif /* TIMERS_H_ */
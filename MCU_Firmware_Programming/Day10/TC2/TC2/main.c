@@ -13,59 +13,11 @@
 #include <avr/io.h>
 #include <util/delay.h>
 #include <avr/interrupt.h> // 인터럽트 사용을 위한 헤더
-
-// 7-Segment Font 배열 (Common Cathode 기준)
-unsigned char Font[18] = {
-    0x3F, 0X06, 0X5B, 0X4F,
-    0X66, 0X6D, 0X7C, 0X07,
-    0X7F, 0X67, 0X77, 0X7C,
-    0X39, 0X5E, 0X79, 0X71,
-    0X08, 0X80
-};
+#include "../../../Common/fnd/fnd.h"
 
 // 캡처된 카운트 값을 저장할 변수 (입력 주기 측정 결과)
 volatile unsigned int m_cnt = 0;
 
-/*
- * Segment 함수
- * - 전달된 4자리 숫자(int N)를 7-Segment에 출력
- * - PORTA: 데이터 (세그먼트 a~g), PORTC: 자릿수 선택 (4개)
- */
-void Segment(int N) {
-    int i;
-    unsigned char N1000, N100, N10, N1;
-    int Buff;
-
-    // 자리수 분리
-    N1000 = N / 1000;
-    Buff = N % 1000;
-
-    N100 = Buff / 100;
-    Buff %= 100;
-
-    N10 = Buff / 10;
-    N1 = Buff % 10;
-
-    // 4자리 스캔 반복 (잔상 제거 및 시인성 확보)
-    for (i = 0; i < 30; i++) {
-        PORTC = 0x0E; // 천의 자리 선택 (PC0 LOW)
-        PORTA = Font[N1000];
-        _delay_ms(1);
-
-        PORTC = 0x0D; // 백의 자리 선택 (PC1 LOW)
-        PORTA = Font[N100];
-        _delay_ms(1);
-
-        PORTC = 0x0B; // 십의 자리 선택 (PC2 LOW)
-        PORTA = Font[N10];
-        _delay_ms(1);
-
-        PORTC = 0x07; // 일의 자리 선택 (PC3 LOW)
-        PORTA = Font[N1];
-        _delay_ms(1);
-    }
-}
-
 /*
  * Timer1 입력 캡처 인터럽트
  * - 외부에서 상승에지(↑)가 발생하면 ICR1에 현재 타이머 값 저장됨
@@ -83,11 +35,8 @@ ISR(TIMER1_CAPT_vect) {
  * - 세그먼트에 측정된 시간 값(m_cnt) 표시
  */
 int main(void) {
-    // 포트 설정
-    DDRA = 0xFF;   // PORTA: 7-Segment 출력용 (a~g)
-    DDRC = 0x0F;   // PORTC: 자릿수 선택용 (4자리)
-    PORTA = 0xFF;  // 초기화 (모든 세그먼트 OFF)
-    PORTC = 0x0F;  // 초기화 (모든 자릿수 OFF)
+    // 7-Segment: PORTA 출력 (a~g), PORTC 자릿수 선택 (Timer3 인터럽트가 자리를 돌림)
+    fnd_init(FND_REFRESH_HZ);
 
     // 타이머0 설정 (CTC 모드, 비교 매치 시 토글 출력)
     // -> PB4(OC0)에서 50% 듀티의 사각파 발생
@@ -97,7 +46,7 @@ int main(void) {
     TCNT0 = 0;           // 초기값
 
     // Timer1 입력 캡처 인터럽트 활성화
-    TIMSK = (1 << TICIE1);  // 입력 캡처 인터럽트 활성화
+    TIMSK |= (1 << TICIE1); // 입력 캡처 인터럽트 활성화
 
     // Timer1 설정
     // ICNC1=0(노이즈 제거 없음), ICES1=1(상승에지 감지), CS12=1 → 분주비 256
@@ -108,6 +57,6 @@ int main(void) {
 
     // 메인 루프
     while (1) {
-        Segment(m_cnt);  // 측정된 시간 간격 값을 7세그먼트에 출력
+        fnd_show_from(&m_cnt);  // 측정된 시간 간격 값을 7세그먼트에 표시 (캡처 ISR과 겹쳐도 한 번에 읽음)
     }
 }
@@ -3,117 +3,76 @@
  *
  * Created: 2025-08-19
  * Author : COMPUTER
- * Description: Timer1을 이용하여 1초 단위로 증가하는 숫자를 
- *              4자리 7-Segment에 표시하는 예제입니다.
+ * Description: 1ms 틱(Timer0)으로 재는 스톱워치를 4자리 7-Segment에 분.초로 표시하는 예제입니다.
+ *              예전에는 Timer1 오버플로마다 TCNT1 = 0xF4C0을 다시 넣어 "200ms"를 셌지만
+ *              실제로는 4000 * 64us = 256ms라 표시되는 초가 약 28% 빨리 갔습니다.
+ *              이제는 틱의 CTC 주기(소수 보정 포함)로 시간을 재므로 몇 시간을 켜 두어도 수정 발진자 오차만큼만 어긋납니다.
+ *
+ * 버튼 (PD0 ~ PD2, 내부 풀업, 누르면 LOW)
+ *   PD0: 시작 / 정지
+ *   PD1: 랩 (누른 순간의 시간을 고정해 표시, 한 번 더 누르면 흐르는 시간으로 돌아감)
+ *   PD2: 리셋 (멈춘 상태면 0으로, 재는 중이면 길게 눌렀을 때 0부터 다시)
  */
 
 #define F_CPU 16000000UL    // 시스템 클럭 주파수 정의 (16MHz)
 
 #include <avr/io.h>         // I/O 포트 관련 라이브러리
 #include <avr/interrupt.h>  // 인터럽트 관련 라이브러리
-#include <util/delay.h>     // 지연 함수 사용을 위한 라이브러리
-
-// 7-Segment에 출력할 숫자(0~9) 및 A~F, 기타 문자의 폰트 배열 (Common Cathode 기준)
-unsigned char Font[18] = {
-    0x3F, // 0
-    0x06, // 1
-    0x5B, // 2
-    0x4F, // 3
-    0x66, // 4
-    0x6D, // 5
-    0x7C, // 6
-    0x07, // 7
-    0x7F, // 8
-    0x67, // 9
-    0x77, // A
-    0x7C, // b
-    0x39, // C
-    0x5E, // d
-    0x79, // E
-    0x71, // F
-    0x08, // - (하이픈)
-    0x80  // . (소수점)
-};
-
-// 카운터 변수
-volatile int t_cnt = 0;  // 200ms 단위 카운트 (5번이면 1초)
-volatile int m_cnt = 0;  // 실제로 1초 단위로 증가하는 값
-
-// 7-Segment에 숫자를 표시하는 함수
-void Segment(int N) {
-    int i;
-    unsigned char N1000, N100, N10, N1;
-    int Buff;
-
-    // 각 자리수 분해
-    N1000 = N / 1000;          // 천의 자리
-    Buff = N % 1000;
-    N100 = Buff / 100;         // 백의 자리
-    Buff %= 100;
-    N10 = Buff / 10;           // 십의 자리
-    N1 = Buff % 10;            // 일의 자리
+#include <avr/sleep.h>      // 슬립 모드 (이벤트가 없을 때 다음 인터럽트까지 잠듦)
+#include "../../../Common/fnd/fnd.h"
+#include "../../../Common/tick/tick.h"
+#include "../../../Common/button/button.h"
+#include "../../../Common/stopwatch/stopwatch.h"
 
-    // 각 자리의 숫자를 세그먼트에 30번 반복 출력하여 충분히 밝게 보이게 함
-    for (i = 0; i < 30; i++) {
-        // 1번째 자리 (천의 자리)
-        PORTC = 0x0E;                  // 첫 번째 자리 ON (PC0 LOW)
-        PORTA = Font[N1000];          // 해당 자리 숫자 출력
-        _delay_ms(1);
+stopwatch_t watch;          // 경과 시간 (메인 루프에서만 씀)
 
-        // 2번째 자리 (백의 자리)
-        PORTC = 0x0D;                  // 두 번째 자리 ON (PC1 LOW)
-        PORTA = Font[N100];
-        _delay_ms(1);
+int main(void) {
+    button_event_t ev;
 
-        // 3번째 자리 (십의 자리)
-        PORTC = 0x0B;                  // 세 번째 자리 ON (PC2 LOW)
-        PORTA = Font[N10];
-        _delay_ms(1);
+    // 포트 A: 세그먼트 숫자 출력용, 포트 C: 세그먼트 자리 선택용 (PC0 ~ PC3)
+    // 자리 전환은 Timer3 비교 일치 인터럽트가 맡음 (자리당 1ms, 250Hz)
+    fnd_init(FND_REFRESH_HZ);
 
-        // 4번째 자리 (일의 자리)
-        PORTC = 0x07;                  // 네 번째 자리 ON (PC3 LOW)
-        PORTA = Font[N1];
-        _delay_ms(1);
-    }
-}
+    // 버튼 입력: PD0 ~ PD2, 내부 풀업
+    DDRD &= ~0x07;
+    PORTD |= 0x07;
 
-// 타이머1 오버플로우 인터럽트 서비스 루틴 (약 200ms 간격)
-ISR(TIMER1_OVF_vect) {
-    TCNT1 = 0xF4C0; // 오버플로우 발생 후 타이머 값 초기화 (16,256 - 4000 = 0xF4C0)
-                    // 16MHz / 1024 = 15.625kHz → 1tick = 64us
-                    // 4000 * 64us = 약 256ms (지연 약간 포함됨)
+    // 1ms 틱 (Timer0 CTC): 스톱워치 시간 기준과 버튼 샘플링
+    tick_init();
+    button_init(&PIND, 0x07);
 
-    t_cnt++;        // 200ms 단위 카운터 증가
+    sei();                              // 전역 인터럽트 허용
 
-    if (t_cnt >= 5) {
-        t_cnt = 0;      // 200ms * 5 = 약 1초가 되면
-        m_cnt++;        // 1초 카운터 증가
+    stopwatch_reset(&watch);
+    stopwatch_start(&watch);            // 켜자마자 재기 시작 (버튼이 없어도 예전처럼 시간이 올라감)
 
-        if (m_cnt >= 10000) {
-            m_cnt = 0;  // 4자리 세그먼트를 넘지 않도록 9999에서 0으로 리셋
+    // 메인 루프: 버튼 이벤트를 처리하고 경과 시간을 분.초로 표시
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    while (1) {
+        while (button_get(&ev)) {
+            if (ev.type == BUTTON_PRESS && ev.code == 0) {
+                if (watch.running) {
+                    stopwatch_stop(&watch);
+                } else {
+                    stopwatch_start(&watch);
+                }
+            } else if (ev.type == BUTTON_PRESS && ev.code == 1) {
+                if (watch.lapped) {
+                    stopwatch_lap_clear(&watch);
+                } else {
+                    stopwatch_lap(&watch);
+                }
+            } else if (ev.code == 2 && ((ev.type == BUTTON_PRESS && !watch.running) || ev.type == BUTTON_HOLD)) {
+                unsigned char was_running = watch.running;
+
+                stopwatch_reset(&watch);
+                if (was_running) {
+                    stopwatch_start(&watch);
+                }
+            }
         }
-    }
-}
-
-int main(void) {
-    // 포트 A: 세그먼트 숫자 출력용 (Font[] 사용)
-    // 포트 C: 세그먼트 자리 선택용 (PC0 ~ PC3)
-    DDRA = 0xFF;     // 포트 A를 출력으로 설정
-    DDRC = 0xFF;     // 포트 C도 출력으로 설정
-
-    PORTA = 0xFF;    // 초기값: 모든 세그먼트 꺼짐
-    PORTC = 0xFF;    // 초기값: 모든 자릿수 꺼짐
 
-    // 타이머1 설정
-    TCCR1A = 0x00;                       // 일반 모드 (Normal Mode)
-    TCCR1B = (1 << CS12) | (1 << CS10);  // 분주비 1024 (클럭 16MHz / 1024 = 약 15.6kHz)
-    TCNT1 = 0xF4C0;                      // 초기 타이머 값 (16비트) 설정
-    TIMSK = (1 << TOIE1);               // 타이머1 오버플로우 인터럽트 허용
-
-    sei();                              // 전역 인터럽트 허용
-
-    // 메인 루프: 1초 간격으로 증가하는 m_cnt 값을 세그먼트에 표시
-    while (1) {
-        Segment(m_cnt);  // 현재 m_cnt 값을 4자리 세그먼트에 표시
+        stopwatch_show(&watch, STOPWATCH_MM_SS);  // 보이는 값(초)이 바뀔 때만 다시 그림
+        sleep_mode();                   // 다음 인터럽트(틱, 화면 갱신)까지 잠듦
     }
 }
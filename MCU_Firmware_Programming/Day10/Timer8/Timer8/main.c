@@ -3,18 +3,20 @@
  *
  * Created: 2025-08-19 오전 10:24:19
  * Author : COMPUTER
- * Description: Timer1을 이용한 Phase Correct PWM 모드로 RGB LED 중
- *              Red(PB5), Green(PB6)을 제어하고 색상을 순차적으로 출력.
+ * Description: Timer1을 이용한 Phase Correct PWM 모드로 RGB LED의
+ *              Red(PB5), Green(PB6), Blue(PB7)를 제어하고 색상 사이를 부드럽게 전환하며 순차 출력.
  */
 
 #define F_CPU 16000000UL
 
 #include <avr/io.h>
-#include <util/delay.h>
+#include <avr/interrupt.h>
+#include "../../../Common/rgbpwm/rgbpwm.h"
+#include "../../../Common/rgbfade/rgbfade.h"
 
 // RGB 색상 테이블 (Red, Green, Blue)
-// Timer1은 PB5(R), PB6(G)만 가능하므로 PB7(B)는 실제 PWM 불가
-unsigned char RGB_Table[5][3] = {
+// Timer1 비교 출력 OC1A(PB5), OC1B(PB6), OC1C(PB7)로 세 채널 모두 PWM 출력
+const unsigned char RGB_Table[5][3] = {
     { 163, 191, 64 },   // Yellowish Green
     { 255, 69, 0 },     // Orange Red
     { 34, 139, 34 },    // Forest Green
@@ -23,33 +25,20 @@ unsigned char RGB_Table[5][3] = {
 };
 
 int main(void) {
-    unsigned char i;
-
-    DDRB = 0xE0;  // PB5, PB6, PB7를 출력으로 설정
-                  // 실질적으로 PB5(OC1A), PB6(OC1B)만 PWM 사용 가능
-
     ASSR = 0x00;  // 비동기 타이머 미사용, 내부 클럭 사용
 
-    // Timer1 설정 (Phase Correct PWM, 8bit 모드)
-    // WGM13:0 = 0001, COM1A1/COM1B1 = 1 (비반전 출력)
-    TCCR1A = (1 << COM1A1) | (1 << COM1B1) | (1 << WGM10);  // 0xA9
-    TCCR1B = (1 << CS11);  // 분주비 8, 16MHz / 8 = 2MHz → 1tick = 0.5us
-                           // 주기 = 256 * 2 (업다운) * 0.5us = 256us
-    TCCR1C = 0x00;
+    // Timer1 설정 (Phase Correct PWM, 10bit 모드) - PB5~PB7 출력 설정 포함
+    // WGM13:0 = 0011, COM1A1/COM1B1/COM1C1 = 1 (비반전 출력)
+    // 분주비 8, 16MHz / 8 = 2MHz → 1tick = 0.5us, 주기 = 1023 * 2 (업다운) * 0.5us = 1.023ms
+    // 감마 보정 후 어두운 색도 단계가 보이지 않도록 10bit 해상도를 사용
+    rgbpwm_init(RGBPWM_PHASE_CORRECT, 10);
 
-    while (1) {
-        for (i = 0; i < 5; i++) {
-            OCR1AL = RGB_Table[i][0];  // PB5 (Red 채널) 듀티 설정
-            OCR1BL = RGB_Table[i][1];  // PB6 (Green 채널) 듀티 설정
+    // 색상마다 0.5초 머문 뒤 0.5초 동안 다음 색으로 전환 (1초 간격, 약 200Hz로 보간)
+    rgbfade_init();
+    rgbfade_play(RGB_Table, 5, 500, 500);
+    sei();  // 보간과 색상 반영은 Timer1 오버플로우 인터럽트가 담당
 
-            // PB7은 타이머와 연결되지 않으므로 직접 ON/OFF 제어 가능 (소프트 PWM 필요 시 별도 구현)
-            if (RGB_Table[i][2] > 127) {
-                PORTB |= (1 << PB7);  // Blue ON
-            } else {
-                PORTB &= ~(1 << PB7); // Blue OFF
-            }
-
-            _delay_ms(1000); // 1초 간격으로 색상 변경
-        }
+    while (1) {
+        // CPU는 할 일 없음 (색상 전환은 전부 인터럽트에서 처리)
     }
 }
@@ -1,9 +1,9 @@
-/*
- * ADC.c
- *
- * Created: 2025-08-20 오후 1:37:47
- * Author : COMPUTER
- */ 
+/*
+ * ADC.c
+ *
+ * Created: 2025-08-20 오후 1:37:47
+ * Author : COMPUTER
+ */ 
 
 
 #define F_CPU 16000000UL
@@ -11,65 +11,79 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
+#include "../../../Common/fnd/fnd.h"
+#include "../../../Common/bcd/bcd.h"
 
-// 7-Segment 표시용 숫자 폰트 (공통 애노드 기준)
-unsigned char Font[18] = {
-	0x3F, 0x06, 0x5B, 0x4F,
-	0x66, 0x6D, 0x7C, 0x07,
-	0x7F, 0x67, 0x77, 0x7C,
-	0x39, 0x5E, 0x79, 0x71,
-	0x08, 0x80
-};
-
-unsigned int adc_data = 0;
-
-// 7-Segment 표시 함수
-void Segment(int N) {
-	int i;
-	unsigned char N1000, N100, N10, N1;
-	int Buff;
+#ifndef BCD_BENCH
+#define BCD_BENCH 0 // 1이면 시작할 때 자릿수 분리 방식별 실행 클럭 수를 7-Segment에 차례로 표시
+#endif
 
-	N1000 = N / 1000;
-	Buff = N % 1000;
+volatile unsigned int adc_data = 0;
 
-	N100 = Buff / 100;
-	Buff = Buff % 100;
-
-	N10 = Buff / 10;
-	N1 = Buff % 10;
+// ADC 변환 완료 인터럽트 서비스 루틴
+ISR(ADC_vect) {
+	adc_data = ADCW;			 // ADC 결과 저장
+	ADCSRA |= (1 << ADSC);		 // 다음 변환 시작
+}
 
-	for (i = 0; i < 30; i++) {
-		PORTC = 0x0E;	// 첫째 자리
-		PORTA = Font[N1000];
-		_delay_ms(1);
+#if BCD_BENCH
+// 측정용으로 Timer1을 씁니다. fnd 드라이버가 Timer1을 받도록 배정을 바꾸면(FND_TIMER=1 또는 RGBPWM_TIMER=3) 빌드 오류로 알려 줍니다.
+TIMER_CLAIM(1, bench)
 
-		PORTC = 0x0D;	// 둘째 자리
-		PORTA = Font[N100];
-		_delay_ms(1);
+// 예전 Segment() 방식 (비교용): int 나눗셈/나머지 6번으로 천/백/십/일의 자리 분리
+static void Split_Div(unsigned int value, unsigned char *digits) {
+	int N = value;
+	int Buff;
 
-		PORTC = 0x0B;	// 셋째 자리
-		PORTA = Font[N10];
-		_delay_ms(1);
+	digits[0] = 0;
+	digits[1] = N / 1000;
+	Buff = N % 1000;
+	digits[2] = Buff / 100;
+	Buff = Buff % 100;
+	digits[3] = Buff / 10;
+	digits[4] = Buff % 10;
+}
 
-		PORTC = 0x07;	// 넷째 자리
-		PORTA = Font[N1];
-		_delay_ms(1);
+// 자릿수 분리 1회의 실행 클럭 수 측정 (Timer1 분주 없음, 0 ~ 9999를 625 간격으로 16번 평균)
+static unsigned int Bench_Cycles(void (*fn)(unsigned int, unsigned char *)) {
+	unsigned char digits[BCD16_DIGITS];
+	unsigned long total = 0;
+	unsigned char sreg = SREG;
+
+	cli(); // 측정 중에는 FND/ADC 인터럽트가 끼어들지 않도록
+	TCCR1A = 0x00;
+	TCCR1B = (1 << CS10);
+	for (unsigned int n = 0; n < 10000; n += 625) {
+		TCNT1 = 0;
+		fn(n, digits);
+		total += TCNT1;
 	}
+	TCCR1B = 0x00;
+	SREG = sreg;
+	return (unsigned int)(total / 16);
 }
 
-// ADC 변환 완료 인터럽트 서비스 루틴
-ISR(ADC_vect) {
-	adc_data = ADCW;			 // ADC 결과 저장
-	ADCSRA |= (1 << ADSC);		 // 다음 변환 시작
+// 값이 그대로일 때 fnd_show() 1회의 실행 클럭 수 (캐시 적중이라 변환 없이 돌아감)
+static unsigned int Bench_Show_Cached(void) {
+	unsigned int cycles;
+	unsigned char sreg = SREG;
+
+	fnd_show(1234);
+	cli();
+	TCCR1A = 0x00;
+	TCNT1 = 0;
+	TCCR1B = (1 << CS10);
+	fnd_show(1234);
+	TCCR1B = 0x00;
+	cycles = TCNT1;
+	SREG = sreg;
+	return cycles;
 }
+#endif
 
 int main(void) {
-	// 7-Segment 출력 포트 설정
-	DDRA = 0xFF;	// PORTA = 세그먼트 출력
-	PORTA = 0x00;
-
-	DDRC = 0x0F;	// PORTC 하위 4비트 = 자리 선택 출력
-	PORTC = 0x0F;
+	// 7-Segment: PORTA 세그먼트, PORTC 하위 4비트 자리 선택 (Timer3 인터럽트가 자리를 돌림)
+	fnd_init(FND_REFRESH_HZ);
 
 	// ADC 포트 설정 (PF0 = ADC0 입력)
 	DDRF &= ~(1 << PF0);	// 입력 설정
@@ -84,7 +98,26 @@ int main(void) {
 	sei();								 // 전역 인터럽트 허용
 	ADCSRA |= (1 << ADSC);				 // 첫 번째 변환 시작
 
+#if BCD_BENCH
+	// 나눗셈 → double dabble → 역수 곱셈 → 같은 값 다시 표시 순으로 클럭 수를 약 2초씩 표시
+	{
+		unsigned int div_cycles = Bench_Cycles(Split_Div);
+		unsigned int dabble_cycles = Bench_Cycles(bcd_dabble16);
+		unsigned int recip_cycles = Bench_Cycles(bcd_recip16);
+		unsigned int cached_cycles = Bench_Show_Cached();
+
+		fnd_show(div_cycles);
+		_delay_ms(2000);
+		fnd_show(dabble_cycles);
+		_delay_ms(2000);
+		fnd_show(recip_cycles);
+		_delay_ms(2000);
+		fnd_show(cached_cycles);
+		_delay_ms(2000);
+	}
+#endif
+
 	while (1) {
-		Segment(adc_data);				 // ADC 값 표시
+		fnd_show_from(&adc_data);		 // ADC 값 표시 (한 번에 읽고, 값이 바뀔 때만 자릿수 변환)
 	}
 }
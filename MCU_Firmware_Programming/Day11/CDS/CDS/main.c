@@ -7,7 +7,8 @@
  * Description:
  * - CDS 조도센서(PF3)를 통해 아날로그 값을 ADC로 읽어
  *   7-segment(4자리)에 표시
- * - 릴레이(PB0)를 통해 팬을 5초 ON, 5초 OFF 반복 제어
+ * - 주변이 어두울수록 7-segment 밝기를 낮춤 (fnd 모듈의 전체 밝기, 갱신 빈도는 그대로)
+ * - 릴레이(PB0)를 통해 팬을 5초 ON, 1초 OFF 반복 제어 (1ms 틱에서 1초마다 판단)
  */
 
 #define F_CPU 16000000UL  // 시스템 클럭 주파수 설정 (16MHz)
@@ -15,79 +16,46 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
-
-// 7-Segment 숫자 폰트 테이블 (공통 애노드 기준)
-// Font[숫자] = 출력할 세그먼트 패턴
-unsigned char Font[18] = {
-	0x3F, // 0
-	0x06, // 1
-	0x5B, // 2
-	0x4F, // 3
-	0x66, // 4
-	0x6D, // 5
-	0x7C, // 6
-	0x07, // 7
-	0x7F, // 8
-	0x67, // 9
-	0x77, // A
-	0x7C, // b
-	0x39, // C
-	0x5E, // d
-	0x79, // E
-	0x71, // F
-	0x08, // -
-	0x80  // .
-};
+#include "../../../Common/fnd/fnd.h"
+#include "../../../Common/tick/tick.h"
 
 // ADC 변환된 데이터 저장용 변수 (인터럽트에서 업데이트)
 volatile unsigned int adc_data = 0;
 
-// 7-Segment에 4자리 숫자 출력하는 함수
-void Segment(int N) {
-	// 4자리 숫자 분리: 천의 자리, 백의 자리, 십의 자리, 일의 자리
-	unsigned char N1000 = N / 1000;
-	unsigned char N100 = (N % 1000) / 100;
-	unsigned char N10  = (N % 100) / 10;
-	unsigned char N1   = N % 10;
-
-	// 잔상 방지 + 눈에 보이게 반복 출력
-	for (int i = 0; i < 80; i++) {
-		// 1. 천의 자리 표시
-		PORTC = 0x0E;                  // 1110 → 첫 번째 자리 선택
-		PORTA = Font[N1000];           // 천의 자리 숫자 출력
-		_delay_ms(5);
-
-		// 2. 백의 자리 표시
-		PORTC = 0x0D;                  // 1101 → 두 번째 자리 선택
-		PORTA = Font[N100];
-		_delay_ms(5);
-
-		// 3. 십의 자리 표시
-		PORTC = 0x0B;                  // 1011 → 세 번째 자리 선택
-		PORTA = Font[N10];
-		_delay_ms(5);
-
-		// 4. 일의 자리 표시
-		PORTC = 0x07;                  // 0111 → 네 번째 자리 선택
-		PORTA = Font[N1];
-		_delay_ms(5);
-	}
-}
-
 // ADC 변환 완료 인터럽트 함수
 ISR(ADC_vect) {
 	adc_data = ADCW;             // 변환된 아날로그 값을 읽어서 저장
 	ADCSRA |= (1 << ADSC);       // 다음 ADC 변환 시작
 }
 
+// 조도 → 7-segment 밝기 (CDS는 어두울수록 ADC 값이 커짐)
+// 밝은 곳(ADC 0)에서는 255, 어두운 곳(ADC 895 이상)에서는 32까지 낮춰 눈부시지 않게 함
+unsigned char Display_Level(unsigned int adc) {
+	if (adc > 895) {
+		adc = 895;
+	}
+	return (unsigned char)(255 - (adc >> 2));
+}
+
+// 릴레이 (FAN) 제어: 1초마다 호출되어 5초 ON, 1초 OFF 반복
+void Relay_Second(void) {
+	static unsigned char sec = 0;
+
+	if (sec < 5) {
+		PORTB |= (1 << PB0);     // PB0 = HIGH → 릴레이 ON
+	} else {
+		PORTB &= ~(1 << PB0);    // PB0 = LOW → 릴레이 OFF
+	}
+	if (++sec >= 6) {
+		sec = 0;
+	}
+}
+
 int main(void) {
 	// ----------------------------------
 	// 1. 포트 초기화
 	// ----------------------------------
-	DDRA = 0xFF;        // PORTA (7-Segment 출력) → 출력 모드 설정
-	DDRC = 0x0F;        // PORTC (자리 선택용) 하위 4비트 출력
-	PORTA = 0x00;       // PORTA 초기화
-	PORTC = 0x0F;       // PORTC 자리 모두 OFF 상태
+	fnd_init(FND_REFRESH_HZ);   // PORTA 7-Segment, PORTC 하위 4비트 자리 선택 (Timer3 인터럽트가 자리를 돌림)
 
 	DDRB |= (1 << PB0);     // PB0 릴레이 제어용 → 출력 설정
 	PORTB &= ~(1 << PB0);   // 릴레이 초기 OFF 상태
@@ -109,6 +77,10 @@ int main(void) {
 
 	_delay_us(10);         // 안정화 시간
 
+	tick_init();                        // Timer0 1ms 틱
+	tick_add_every(Relay_Second, 1000); // 릴레이는 1초 단위로 틱에서 처리
+	Relay_Second();                     // 시작하자마자 릴레이 ON
+
 	sei();                 // 전역 인터럽트 활성화
 
 	ADCSRA |= (1 << ADSC); // 첫 번째 변환 시작
@@ -117,14 +89,10 @@ int main(void) {
 	// 3. 메인 루프
 	// ----------------------------------
 	while (1) {
-		// [1] 조도센서 값 표시
-		Segment(adc_data);
-
-		// [2] 릴레이 (FAN) 제어
-		PORTB |= (1 << PB0);     // PB0 = HIGH → 릴레이 ON
-		_delay_ms(5000);         // 5초 동안 동작
+		// [1] 조도센서 값 표시 (인터럽트를 막고 한 번에 읽음, 값이 바뀔 때만 자릿수 변환)
+		unsigned int adc = fnd_show_from(&adc_data);
 
-		PORTB &= ~(1 << PB0);    // PB0 = LOW → 릴레이 OFF
-		_delay_ms(1000);         // 1초 정지
+		// [2] 조도에 따라 표시 밝기 조절 (같은 밝기면 바로 돌아감)
+		fnd_set_brightness(Display_Level(adc));
 	}
 }
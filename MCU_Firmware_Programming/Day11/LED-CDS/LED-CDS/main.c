@@ -12,56 +12,10 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
-
-// 7-Segment 숫자 폰트 테이블 (공통 애노드 기준)
-unsigned char Font[18] = {
-	0x3F, 0x06, 0x5B, 0x4F,
-	0x66, 0x6D, 0x7C, 0x07,
-	0x7F, 0x67, 0x77, 0x7C,
-	0x39, 0x5E, 0x79, 0x71,
-	0x08, 0x80
-};
+#include "../../../Common/fnd/fnd.h"
 
 volatile unsigned int adc_data = 0; // ADC 변환값 저장 변수 (ISR에서 수정됨)
 
-// 4자리 7-segment에 숫자 출력 함수
-void Segment(int N) {
-	int i;
-	unsigned char N1000, N100, N10, N1;
-	int Buff;
-
-	// 4자리 숫자 분리
-	N1000 = N / 1000;
-	Buff = N % 1000;
-	N100 = Buff / 100;
-	Buff = Buff % 100;
-	N10 = Buff / 10;
-	N1 = Buff % 10;
-
-	// 각 자리별로 30번씩 빠르게 반복 출력 (잔상효과)
-	for (i = 0; i < 30; i++) {
-		// 1천 자리
-		PORTC = 0x0E;
-		PORTA = Font[N1000];
-		_delay_ms(1);
-
-		// 100 자리
-		PORTC = 0x0D;
-		PORTA = Font[N100];
-		_delay_ms(1);
-
-		// 10 자리
-		PORTC = 0x0B;
-		PORTA = Font[N10];
-		_delay_ms(1);
-
-		// 1 자리
-		PORTC = 0x07;
-		PORTA = Font[N1];
-		_delay_ms(1);
-	}
-}
-
 // ADC 변환 완료 인터럽트 서비스 루틴
 ISR(ADC_vect) {
 	adc_data = ADCW;            // ADC 변환 결과 읽기
@@ -102,10 +56,7 @@ void LED_Display(unsigned int adc_val) {
 
 int main(void) {
 	// 포트 설정
-	DDRA = 0xFF;    // PORTA : 7-segment 숫자 출력 (출력)
-	DDRC = 0x0F;    // PORTC : 7-segment 자리 선택 (하위 4비트 출력)
-	PORTA = 0x00;
-	PORTC = 0x0F;
+	fnd_init(FND_REFRESH_HZ); // PORTA 7-segment 숫자, PORTC 하위 4비트 자리 선택 (Timer3 인터럽트가 자리를 돌림)
 
 	DDRE = 0xFF;    // PORTE : LED 8개 연결, 출력으로 설정
 	PORTE = 0x00;   // 초기 LED 모두 끔
@@ -125,7 +76,7 @@ int main(void) {
 	ADCSRA |= (1 << ADSC);          // 첫 번째 ADC 변환 시작
 
 	while (1) {
-		Segment(adc_data);           // ADC 값을 7-segment에 출력
-		LED_Display(adc_data);       // ADC 값에 따라 LED 점등 제어
+		unsigned int adc = fnd_show_from(&adc_data);   // ADC 값을 한 번에 읽어 7-segment에 표시
+		LED_Display(adc);            // 같은 값으로 LED 점등 제어 (세그먼트와 LED가 어긋나지 않음)
 	}
 }
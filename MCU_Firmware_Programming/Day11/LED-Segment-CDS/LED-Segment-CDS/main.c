@@ -2,39 +2,21 @@
 
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 
-// 7세그먼트 폰트 (0~9, A~F 등 일부 문자 포함)
-unsigned char Font[18] = {
-	0x3F, 0x06, 0x5B, 0x4F,
-	0x66, 0x6D, 0x7C, 0x07,
-	0x7F, 0x67, 0x77, 0x7C,
-	0x39, 0x5E, 0x79, 0x71,
-	0x08, 0x80
-};
+#include "../../../Common/bam/bam.h" // Timer2 인터럽트로 8채널 밝기를 출력하는 BAM 엔진
+#include "../../../Common/fnd/fnd.h" // Timer3 인터럽트로 자리를 돌리는 7세그먼트 드라이버
+#include "cds_tables.h"              // 조도 → 밝기 변환표 (make -C host tables로 생성)
+
+#ifndef CDS_BENCH
+#define CDS_BENCH 0 // 1이면 시작할 때 예전 계산 방식과 변환표의 실행 클럭 수를 7세그먼트에 차례로 표시
+#endif
 
 volatile unsigned int adc_data = 0;   // ADC 변환 결과 저장 변수 (인터럽트 내 업데이트)
 
 // LED 밝기 배열 (각 LED 밝기 값, 0~255)
-unsigned char led_brightness[8] = {0};
-
-// 4자리 7세그먼트 숫자 출력 함수
-void Segment(int N) {
-	unsigned char N1000 = N / 1000;
-	int buff = N % 1000;
-	unsigned char N100 = buff / 100;
-	buff = buff % 100;
-	unsigned char N10 = buff / 10;
-	unsigned char N1 = buff % 10;
-
-	// 각 자리수별로 빠르게 순차 출력 (멀티플렉싱)
-	for (int i = 0; i < 30; i++) {
-		PORTC = 0x0E; PORTA = Font[N1000]; _delay_ms(1);
-		PORTC = 0x0D; PORTA = Font[N100];  _delay_ms(1);
-		PORTC = 0x0B; PORTA = Font[N10];   _delay_ms(1);
-		PORTC = 0x07; PORTA = Font[N1];    _delay_ms(1);
-	}
-}
+unsigned char led_brightness[CDS_LED_COUNT] = {0};
 
 // ADC 변환 완료 인터럽트 서비스 루틴
 ISR(ADC_vect) {
@@ -42,8 +24,23 @@ ISR(ADC_vect) {
 	ADCSRA |= (1 << ADSC);  // 다음 ADC 변환 시작
 }
 
-// LED 밝기를 ADC 값에 따라 4단계로 설정하는 함수
+// LED 밝기를 ADC 값에 따라 6단계로 설정하는 함수
+// 역비례 밝기 계산, LED별 비율, 6단계 양자화, 감마 보정은 cds_tables.h에 미리 계산되어 있으므로
+// ADC 값으로 전체 밝기를 한 번 찾고, LED마다 표를 한 번씩 읽기만 합니다.
 void Set_LED_Brightness(unsigned int adc_val) {
+	unsigned char overall = pgm_read_byte(&cds_brightness[adc_val & 0x3FF]);
+
+	for (unsigned char i = 0; i < CDS_LED_COUNT; i++) {
+		led_brightness[i] = pgm_read_byte(&cds_led_level[i][overall]);
+	}
+}
+
+#if CDS_BENCH
+// 측정용으로 Timer1을 씁니다. fnd 드라이버가 Timer1을 받도록 배정을 바꾸면(FND_TIMER=1 또는 RGBPWM_TIMER=3) 빌드 오류로 알려 줍니다.
+TIMER_CLAIM(1, bench)
+
+// 예전 방식 (비교용): 루프마다 32비트 곱셈/나눗셈 후 LED마다 6단계 최근접 탐색
+static void Set_LED_Brightness_Calc(unsigned int adc_val) {
 	const unsigned int threshold_min = 0;
 	const unsigned int threshold_max = 700;
 
@@ -75,32 +72,32 @@ void Set_LED_Brightness(unsigned int adc_val) {
 	}
 }
 
-
-// 소프트웨어 PWM 함수: pwm_counter와 led_brightness 비교해 LED ON/OFF 조절
-void LED_SoftwarePWM(void) {
-	static unsigned char pwm_counter = 0;
-	unsigned char port_value = 0;
-
-	for (int i = 0; i < 8; i++) {
-		// pwm_counter가 led_brightness[i]보다 작으면 LED ON
-		if (pwm_counter < led_brightness[i]) {
-			port_value |= (1 << i);
-		}
+// 밝기 설정 함수 1회의 실행 클럭 수 측정 (Timer1 분주 없음, ADC 0 ~ 1023을 64 간격으로 16번 평균)
+static unsigned int Bench_Cycles(void (*fn)(unsigned int)) {
+	unsigned long total = 0;
+	unsigned char sreg = SREG;
+
+	cli(); // 측정 중에는 BAM/FND/ADC 인터럽트가 끼어들지 않도록
+	TCCR1A = 0x00;
+	TCCR1B = (1 << CS10);
+	for (unsigned int adc = 0; adc < 1024; adc += 64) {
+		TCNT1 = 0;
+		fn(adc);
+		total += TCNT1;
 	}
-
-	PORTE = port_value;  // LED 출력 포트에 값 쓰기
-	pwm_counter++;       // 카운터 증가 (0~255 자동 오버플로우)
+	TCCR1B = 0x00;
+	SREG = sreg;
+	return (unsigned int)(total / 16);
 }
+#endif
 
 int main(void) {
 	// 포트 초기화
-	DDRA = 0xFF;    // 7세그먼트 데이터 출력 (포트 A)
-	DDRC = 0x0F;    // 7세그먼트 자리 선택 (포트 C 하위 4비트)
-	PORTA = 0x00;
-	PORTC = 0x0F;
+	fnd_init(FND_REFRESH_HZ); // 7세그먼트 데이터 (포트 A), 자리 선택 (포트 C 하위 4비트)
 
 	DDRE = 0xFF;    // LED 출력 (포트 E)
 	PORTE = 0x00;
+	bam_init(&PORTE); // PORTE의 8비트를 BAM 출력으로 사용 (Timer2 인터럽트가 계속 출력)
 
 	// ADC 입력 핀 (PF3) 설정
 	DDRF &= ~(1 << PF3);  // 입력으로 설정
@@ -117,17 +114,27 @@ int main(void) {
 	sei();              // 전역 인터럽트 활성화
 	ADCSRA |= (1 << ADSC); // ADC 변환 시작
 
-	while (1) {
-		// ADC 값에 따라 LED 밝기 단계 설정
-		Set_LED_Brightness(adc_data);
+#if CDS_BENCH
+	// 예전 방식 → 변환표 → 절약한 클럭 수를 각각 약 2초씩 표시
+	{
+		unsigned int calc_cycles = Bench_Cycles(Set_LED_Brightness_Calc);
+		unsigned int table_cycles = Bench_Cycles(Set_LED_Brightness);
+
+		fnd_show(calc_cycles);
+		_delay_ms(2000);
+		fnd_show(table_cycles);
+		_delay_ms(2000);
+		fnd_show(calc_cycles - table_cycles);
+		_delay_ms(2000);
+	}
+#endif
 
-		// ADC 값을 7세그먼트로 표시
-		Segment(adc_data);
+	while (1) {
+		// ADC 값을 한 번에 읽어 7세그먼트로 표시 (자리 전환은 Timer3 인터럽트가 처리)
+		unsigned int adc = fnd_show_from(&adc_data);
 
-		// 소프트웨어 PWM으로 LED 밝기 제어 (50 사이클, 약 5ms)
-		for (int i = 0; i < 50; i++) {
-			LED_SoftwarePWM();
-			_delay_us(100);
-		}
+		// 같은 값으로 LED 밝기 단계 설정 후 BAM에 반영 (출력은 Timer2 인터럽트가 처리)
+		Set_LED_Brightness(adc);
+		bam_set_all(led_brightness);
 	}
 }
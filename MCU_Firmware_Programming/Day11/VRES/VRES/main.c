@@ -9,53 +9,11 @@
 
 #include <util/delay.h>
 #include <avr/io.h>
+#include "../../../Common/fnd/fnd.h"
+#include "../../../Common/fndtext/fndtext.h"
 
-// 7-seg Font 배열 (0~9 및 몇몇 문자)
-unsigned char Font[18] = {
-	0x3F, 0x06, 0x5B, 0x4F,
-	0x66, 0x6D, 0x7C, 0x07,
-	0x7F, 0x67, 0x77, 0x7C,
-	0x39, 0x5E, 0x79, 0x71,
-	0x08, 0x80
-};
-
-void Segment(int N);
 unsigned int adc_data= 0;
 
-// 7-segment 4자리 출력 함수
-void Segment(int N){
-	int i;
-	unsigned char N1000, N100, N10, N1;
-	int Buff;
-	
-	N1000 = N/1000;
-	Buff = N%1000;
-	
-	N100 = Buff/100;
-	Buff = Buff%100;
-	
-	N10 = Buff/10;
-	N1 = Buff%10;
-	
-	for(i=0; i<30; i++){
-		PORTC = 0x0E;	// 첫 번째 자리 선택 (예: 1110)
-		PORTA = Font[N1000];
-		_delay_ms(1);
-		
-		PORTC = 0x0D;	// 두 번째 자리 선택 (예: 1101)
-		PORTA = Font[N100];
-		_delay_ms(1);
-		
-		PORTC = 0x0B;	// 세 번째 자리 선택 (예: 1011)
-		PORTA = Font[N10];
-		_delay_ms(1);
-		
-		PORTC = 0x07;	// 네 번째 자리 선택 (예: 0111)
-		PORTA = Font[N1];
-		_delay_ms(1);
-	}
-}
-
 // ADC값 읽기 함수
 unsigned int read_adc(void){
 	ADCSRA |= (1 << ADSC);	// ADC 변환 시작
@@ -66,13 +24,13 @@ unsigned int read_adc(void){
 }
 
 int main(void){
-	// PORTA: 7-seg segment 출력 (출력)
-	DDRA = 0xFF;
-	PORTA = 0x00;
+	// 7-seg: PORTA 세그먼트, PORTC 하위 4비트 자리 선택 (Timer3 인터럽트가 자리를 돌림)
+	fnd_init(FND_REFRESH_HZ);
+	tick_init();
+	sei();
 	
-	// PORTC: 7-seg 자리 선택 출력 (출력)
-	DDRC = 0x0F;	// 하위 4비트만 출력으로 설정
-	PORTC = 0x0F;	// 초기값 설정
+	// 시작 안내 문구를 한 번 흘려 보냄 (틱에서 300ms마다 한 칸씩, 그동안에도 ADC는 계속 읽음)
+	fndtext_scroll_P(PSTR("VRES 0-1023"), 300, 1);
 	
 	// ADC 초기화 (AVcc 기준, 채널0, 분주비 128)
 	ADMUX = (1 << REFS0);			// AVcc를 기준 전압으로 설정, ADC0 선택
@@ -84,7 +42,9 @@ int main(void){
 		
 		// ADC값을 0~9999 범위로 변환해서 출력 (원한다면 수정 가능)
 		// 여기서는 0~1023 범위를 그대로 0~1023 출력 (4자리)
-		Segment(adc_data);
+		if (!fndtext_busy()) {
+			fnd_show(adc_data);
+		}
 	}
 	
 	return 0;
@@ -9,8 +9,34 @@
  * - 캐소드 방식 (common cathode): 공통 GND, 각 단자는 VCC로 연결되어 점등
  */
 
-#include <avr/io.h>      // AVR의 입출력 레지스터 정의 헤더
-#include <util/delay.h>  // _delay_ms() 함수 사용을 위한 헤더
+#include <avr/io.h>          // AVR의 입출력 레지스터 정의 헤더
+#include <avr/interrupt.h>   // sei() 사용을 위한 헤더
+
+#include "../../../Common/tick/tick.h" // Timer0 1ms 틱
+#include "../../../Common/seq/seq.h"   // 플래시 패턴 시퀀서
+
+// 세그먼트 한 칸씩 점등: 0x01 → 0x02 → ... → 0x80 (0.5초 간격)
+// 0x01을 출력한 뒤 왼쪽으로 7번 회전 → 8프레임을 4바이트로 저장
+const unsigned char walk_frames[] PROGMEM = {
+    SEQ_SET(0x01, 1),
+    SEQ_ROL(7),
+    SEQ_END
+};
+
+// 전체 깜빡임: 모두 켬 → XOR로 5번 반전 (켜짐/꺼짐 교대) → 꺼진 채 2프레임 유지
+const unsigned char blink_frames[] PROGMEM = {
+    SEQ_SET(0xFF, 1),
+    SEQ_XOR(0xFF, 5),
+    SEQ_HOLD(2),
+    SEQ_END
+};
+
+// 한 칸씩 점등을 2바퀴 돌린 뒤 0.2초 간격 깜빡임 1번, 다시 처음으로 (서로 이어서 무한 반복)
+extern const seq_pattern_t blink_pattern;
+const seq_pattern_t walk_pattern PROGMEM = { walk_frames, 500, 2, &blink_pattern };
+const seq_pattern_t blink_pattern PROGMEM = { blink_frames, 200, 1, &walk_pattern };
+
+seq_player_t fnd_player;
 
 int main(void)
 {
@@ -18,39 +44,13 @@ int main(void)
     DDRG = 0xff;    // 포트 G의 모든 핀도 출력으로 설정
     PORTG = 0x07;   // 포트 G의 출력을 모두 0으로 초기화 (예: 선택된 FND가 없도록 설정) ob0000 0111
 
+    tick_init();
+    seq_init();
+    seq_start(&fnd_player, &PORTB, &walk_pattern); // 포트 B 출력은 1ms 틱 인터럽트가 담당
+    sei();
+
     while (1) 
     {
-        // 포트 B에 0x01 출력 → 0000 0001 (가장 오른쪽 비트만 HIGH)
-        // 이후 0.5초 대기
-        PORTB = 0x01;
-        _delay_ms(500);
-
-        // 포트 B에 0x02 출력 → 0000 0010 (두 번째 비트만 HIGH)
-        PORTB = 0x02;
-        _delay_ms(500);
-
-        // 포트 B에 0x04 출력 → 0000 0100 (세 번째 비트만 HIGH)
-        PORTB = 0x04;
-        _delay_ms(500);
-
-        // 포트 B에 0x08 출력 → 0000 1000 (네 번째 비트만 HIGH)
-        PORTB = 0x08;
-        _delay_ms(500);
-
-        // 포트 B에 0x10 출력 → 0001 0000 (다섯 번째 비트만 HIGH)
-        PORTB = 0x10;
-        _delay_ms(500);
-
-        // 포트 B에 0x20 출력 → 0010 0000 (여섯 번째 비트만 HIGH)
-        PORTB = 0x20;
-        _delay_ms(500);
-
-        // 포트 B에 0x40 출력 → 0100 0000 (일곱 번째 비트만 HIGH)
-        PORTB = 0x40;
-        _delay_ms(500);
-
-        // 포트 B에 0x80 출력 → 1000 0000 (가장 왼쪽 비트만 HIGH)
-        PORTB = 0x80;
-        _delay_ms(500);
+        // CPU는 할 일 없음 (패턴 재생은 인터럽트에서 처리)
     }
 }
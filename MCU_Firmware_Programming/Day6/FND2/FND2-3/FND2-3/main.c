@@ -1,99 +1,57 @@
-#include <avr/io.h>
-#include <util/delay.h>
-
-// 7세그먼트 폰트 배열 (공통 캐소드용)
-unsigned char Font[16] = {
-	0b00111111, // 0
-	0b00000110, // 1
-	0b01011011, // 2
-	0b01001111, // 3
-	0b01100110, // 4
-	0b01101101, // 5
-	0b01111101, // 6
-	0b00000111, // 7
-	0b01111111, // 8
-	0b01101111, // 9
-	0b01110111, // A
-	0b01111100, // b
-	0b00111001, // C
-	0b01011110, // d
-	0b01111001, // E
-	0b01110001  // F
-};
-
-// 자릿수 선택 (PORTG, LOW가 해당 자리 활성화)
-unsigned char digitSelect[4] = {
-	0b0111, // 천의 자리
-	0b1011, // 백의 자리
-	0b1101, // 십의 자리
-	0b1110  // 일의 자리
-};
-
-// 숫자를 7세그에 출력하는 함수
-void display_number(uint16_t number) {
-	unsigned char digits[4];
-
-	digits[0] = number % 10;
-	digits[1] = (number / 10) % 10;
-	digits[2] = (number / 100) % 10;
-	digits[3] = (number / 1000) % 10;
-
-	for (int i = 0; i < 4; i++) {
-		PORTB = Font[digits[i]];  // 세그먼트 출력
-		PORTG = digitSelect[i];   // 자릿수 선택 (LOW)
-		_delay_ms(2);
-	}
+#define F_CPU 16000000UL // 시스템 클럭 16MHz
 
-	PORTG = 0xFF; // 자릿수 OFF
-}
-
-// FND OFF 함수
-void fnd_off() {
-	PORTB = 0x00;  // 세그먼트 OFF
-	PORTG = 0xFF;  // 모든 자릿수 OFF
-}
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+// FND: PORTB 세그먼트, PG0~PG3 자릿수 (프로젝트 심볼 FND_BOARD=FND_BOARD_PORTB_G, Timer3 인터럽트가 자리를 돌림)
+#include "../../../../Common/fnd/fnd.h"
+// 버튼: 1ms 틱(Timer0)에서 PIND를 샘플링해 채터링을 거르고 눌림/뗌 이벤트를 큐에 넣음
+#include "../../../../Common/button/button.h"
 
 int main(void)
 {
 	// 포트 설정
-	DDRB = 0xFF;   // PORTB: FND 세그먼트 출력
-	DDRG = 0xFF;   // PORTG: FND 자릿수 제어
+	fnd_init(FND_REFRESH_HZ);  // PORTB: FND 세그먼트 출력, PORTG: FND 자릿수 제어
 	DDRE = 0xFF;   // PORTE: LED 출력
 	DDRD = 0x00;   // PORTD: 버튼 입력
 	PORTD = 0xFF;  // 내부 풀업 저항 활성화
 
-	PORTE = 0x00;  // LED OFF 초기화
-	PORTG = 0xFF;  // 모든 자릿수 OFF
-	PORTB = 0x00;  // 세그먼트 OFF
+	PORTE = 0xFF;  // LED 초기화 (버튼 상태와 같게, 안 눌림 = HIGH)
+	tick_init();
+	button_init(&PIND, 0xFF);  // PD0~PD7 8개 버튼
+	sei();
 
 	uint16_t counter = 0;
-	uint8_t prev_buttons = 0xFF;
+	button_event_t ev;
 
+	set_sleep_mode(SLEEP_MODE_IDLE);
 	while (1)
 	{
-		uint8_t buttons = PIND;
-
-		// 버튼 눌림 감지 (이전엔 HIGH, 지금 LOW → 새롭게 눌린 상태)
-		uint8_t pressed = (prev_buttons & ~buttons);
+		// 버튼 이벤트가 없으면 다음 인터럽트(틱, 화면 갱신)까지 잠듦. 채터링은 버튼 모듈이 거르므로 따로 쉬지 않음
+		if (!button_get(&ev)) {
+			sleep_mode();
+			continue;
+		}
 
-		if (pressed != 0) {
-			if (pressed & (1 << 0)) {  // 8번 버튼 눌림
+		// 버튼 눌림 (채터링이 끝난 뒤 버튼마다 한 번)
+		if (ev.type == BUTTON_PRESS) {
+			if (ev.code == 0) {        // 8번 버튼 눌림
 				counter = 0;           // 숫자 초기화
-				} else if (counter < 9999) {
+			} else if (counter < 9999) {
 				counter++;             // 나머지 버튼은 카운터 증가
 			}
 		}
 
-		prev_buttons = buttons;
+		uint8_t held = button_state();  // 채터링을 거른 현재 버튼 상태 (1 = 눌림)
 
-		// LED 상태 업데이트 (버튼과 1:1 매칭)
-		PORTE = buttons;
+		// LED 상태 업데이트 (버튼과 1:1 매칭, 눌린 버튼 = LOW)
+		PORTE = ~held;
 
 		// 버튼이 눌려 있으면 FND 표시
-		if (buttons != 0xFF) {
-			display_number(counter);
-			} else {
-			fnd_off();  // 버튼 안 눌렸으면 FND OFF
+		if (held) {
+			fnd_show(counter);
+		} else {
+			fnd_clear();  // 버튼 안 눌렸으면 FND OFF
 		}
 	}
 }
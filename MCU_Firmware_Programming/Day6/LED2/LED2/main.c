@@ -7,34 +7,34 @@
  */ 
 
 #include <avr/io.h>
-#include <util/delay.h>
+#include <avr/interrupt.h>
+
+#include "../../../Common/tick/tick.h" // Timer0 1ms 틱
+#include "../../../Common/seq/seq.h"   // 플래시 패턴 시퀀서
+
+// 한 칸씩 이동하는 점등 패턴 (0x01 → 0x02 → ... → 0x80, 8프레임을 4바이트로)
+// 0x01을 출력한 뒤 왼쪽으로 7번 회전하고, 끝나면 처음부터 반복
+const unsigned char shift_frames[] PROGMEM = {
+	SEQ_SET(0x01, 1),
+	SEQ_ROL(7),
+	SEQ_END
+};
+const seq_pattern_t shift_pattern PROGMEM = { shift_frames, 500, 0, 0 }; // 0.5초 간격, 무한 반복
+
+seq_player_t led_player;
 
 int main(void)
 {
-	/* Replace with your application code */
-    unsigned char LED = 0x01;
 	DDRE = 0xff;					// PORT를 출력 핀으로 설정
-	
+
+	tick_init();
+	seq_init();
+	seq_start(&led_player, &PORTE, &shift_pattern); // PORTE 출력은 1ms 틱 인터럽트가 담당
+	sei();
+
 	while (1) 
     {
-		PORTE = LED;
-		_delay_ms(500);
-		LED = LED << 1;
-		/*
-		PORTE = 0x01;
-		_delay_ms(500);
-		PORTE = 0x02;
-		_delay_ms(500);
-		PORTE = 0x04;
-		_delay_ms(500);
-		PORTE = 0x10;
-		_delay_ms(500);
-		PORTE = 0x20;
-		_delay_ms(500);
-		PORTE = 0x40;
-		_delay_ms(500);
-		PORTE = 0x80;
-		_delay_ms(500);*/
+		// CPU는 할 일 없음 (_delay_ms()로 막혀 있지 않으므로 다른 작업을 넣을 수 있음)
     }
 }
 
@@ -9,51 +9,11 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
-
-// 7-Segment 숫자 폰트 (공통 애노드 기준)
-const unsigned char Font[18] = {
-    0x3F, 0x06, 0x5B, 0x4F,
-    0x66, 0x6D, 0x7C, 0x07,
-    0x7F, 0x67, 0x77, 0x7C,
-    0x39, 0x5E, 0x79, 0x71,
-    0x08, 0x80
-};
+#include "../../../Common/fnd/fnd.h"
 
 // 전역 변수
-volatile int t_cnt = 0, m_cnt = 0;
-
-// 4자리 7-세그먼트 표시 함수
-void Segment(int N)
-{
-    int i;
-    unsigned char N1000, N100, N10, N1;
-    int Buff;
-
-    N1000 = N / 1000;
-    Buff = N % 1000;
-    N100 = Buff / 100;
-    Buff %= 100;
-    N10 = Buff / 10;
-    N1 = Buff % 10;
-
-    for(i = 0; i < 30; i++) {
-        PORTC = 0x0E;  // 첫째 자리 ON
-        PORTA = Font[N1000];
-        _delay_ms(1);
-
-        PORTC = 0x0D;  // 둘째 자리 ON
-        PORTA = Font[N100];
-        _delay_ms(1);
-
-        PORTC = 0x0B;  // 셋째 자리 ON
-        PORTA = Font[N10];
-        _delay_ms(1);
-
-        PORTC = 0x07;  // 넷째 자리 ON
-        PORTA = Font[N1];
-        _delay_ms(1);
-    }
-}
+volatile int t_cnt = 0;
+volatile unsigned int m_cnt = 0;  // ISR이 바꾸고 메인 루프가 읽음 (fnd_show_from으로 한 번에 읽음)
 
 // Timer2 출력비교 인터럽트 (CTC 모드)
 ISR(TIMER2_COMP_vect)
@@ -69,11 +29,8 @@ ISR(TIMER2_COMP_vect)
 
 int main(void)
 {
-    // 세그먼트 제어 포트 설정
-    DDRA = 0xFF;  // 세그먼트 데이터 포트
-    DDRC = 0x0F;  // 세그먼트 자릿수 선택 포트
-    PORTA = 0xFF; // 초기값
-    PORTC = 0x00;
+    // 세그먼트: PORTA 데이터, PC0~PC3 자릿수 선택 (Timer3 인터럽트가 자리를 돌림)
+    fnd_init(FND_REFRESH_HZ);
 
     // Timer2 설정 (CTC 모드, 분주비 1024)
     TCCR2 = (1 << WGM21) | (1 << CS22) | (1 << CS21) | (1 << CS20); // CTC + 1024 분주
@@ -84,6 +41,6 @@ int main(void)
     sei();  // 전역 인터럽트 허용
 
     while (1) {
-        Segment(m_cnt);  // 현재 카운트 표시
+        fnd_show_from(&m_cnt);  // 현재 카운트 표시
     }
 }
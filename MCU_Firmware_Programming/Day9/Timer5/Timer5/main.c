@@ -2,6 +2,8 @@
  * Timer5_Improved.c
  * Timer0 Fast PWM 모드 + OVF, COMP 인터럽트 사용
  * 2개의 2자리 7-seg 숫자 카운터 출력 (좌우 분리)
+ * 화면 나누기는 Common/fndlayout 뷰 2개로 하고, fnd 드라이버 인터럽트가 화면을 그림
+ * (프로젝트 심볼: F_CPU=14745600UL, FND_FRAME_HOOK=fndlayout_compose)
  *
  * Created: 2025-08-18 오후 4:14:37
  * Author : COMPUTER
@@ -12,55 +14,12 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
-
-// 7-seg 숫자 폰트 (공통 애노드 기준)
-unsigned char Font[18] = {
-    0x3F, 0x06, 0x5B, 0x4F,
-    0x66, 0x6D, 0x7C, 0x07,
-    0x7F, 0x67, 0x77, 0x7C,
-    0x39, 0x5E, 0x79, 0x71,
-    0x08, 0x80
-};
+#include <avr/sleep.h>
+#include "../../../Common/fndlayout/fndlayout.h"
 
 // 타이머 카운터 변수
-volatile int tr_cnt = 0, mr_cnt = 0; // 오른쪽 카운터: 타이머 오버플로우 기준
-volatile int tl_cnt = 0, ml_cnt = 0; // 왼쪽 카운터: 타이머 출력 비교 기준
-
-// 오른쪽 2자리 7-seg 출력 함수
-void RSegment(int N)
-{
-    int i;
-    unsigned char N10 = N / 10;
-    unsigned char N1 = N % 10;
-
-    for (i = 0; i < 5; i++) {
-        PORTC = 0x0B;      // 오른쪽 3번째 자리 선택 (PC3=0, 나머지 1)
-        PORTA = Font[N10]; // 십의 자리 출력
-        _delay_ms(1);
-
-        PORTC = 0x07;      // 오른쪽 4번째 자리 선택 (PC0=0)
-        PORTA = Font[N1];  // 일의 자리 출력
-        _delay_ms(1);
-    }
-}
-
-// 왼쪽 2자리 7-seg 출력 함수
-void LSegment(int N)
-{
-    int i;
-    unsigned char N10 = N / 10;
-    unsigned char N1 = N % 10;
-
-    for (i = 0; i < 5; i++) {
-        PORTC = 0x0E;      // 왼쪽 1번째 자리 선택 (PC1=0)
-        PORTA = Font[N10]; // 십의 자리 출력
-        _delay_ms(1);
-
-        PORTC = 0x0D;      // 왼쪽 2번째 자리 선택 (PC2=0)
-        PORTA = Font[N1];  // 일의 자리 출력
-        _delay_ms(1);
-    }
-}
+volatile unsigned int tr_cnt = 0, mr_cnt = 0; // 오른쪽 카운터: 타이머 오버플로우 기준
+volatile unsigned int tl_cnt = 0, ml_cnt = 0; // 왼쪽 카운터: 타이머 출력 비교 기준
 
 // Timer0 Overflow 인터럽트 서비스 루틴
 ISR(TIMER0_OVF_vect)
@@ -88,11 +47,11 @@ ISR(TIMER0_COMP_vect)
 
 int main(void)
 {
-    // 포트 설정
-    DDRA = 0xFF;    // PORTA: 7-seg 데이터 출력 (출력)
-    DDRC = 0x0F;    // PORTC 하위 4비트: 7-seg 자리 선택 출력
-    PORTA = 0xFF;   // 초기값 - 모두 소등 (공통 애노드 기준)
-    PORTC = 0x0F;   // 자리 선택 모두 비활성화 (1로 셋팅)
+    // 7-seg: PORTA 세그먼트, PC0~PC3 자리 선택 (Timer3 인터럽트가 자리를 돌림)
+    // 왼쪽 2자리 = ml_cnt, 오른쪽 2자리 = mr_cnt (10진수, 앞자리 0도 표시)
+    fnd_init(FND_REFRESH_HZ);
+    fndlayout_add(0, 2, &ml_cnt, FNDLAYOUT_DEC);
+    fndlayout_add(2, 2, &mr_cnt, FNDLAYOUT_DEC);
 
     DDRB = 0x10;    // PB4 (OC0) 출력 설정
 
@@ -118,9 +77,10 @@ int main(void)
 
     sei();        // 전역 인터럽트 허용
 
+    // 좌우 카운트 표시는 fnd 인터럽트가 화면을 한 바퀴 돌 때마다 fndlayout_compose()로 갱신하므로
+    // 메인 루프는 할 일이 없어 Idle 슬립으로 기다림 (Timer0, Timer3는 Idle에서도 동작)
+    set_sleep_mode(SLEEP_MODE_IDLE);
     while (1) {
-        // 좌우 7-seg에 카운트 출력 (2자리씩)
-        LSegment(ml_cnt);
-        RSegment(mr_cnt);
+        sleep_mode();
     }
 }
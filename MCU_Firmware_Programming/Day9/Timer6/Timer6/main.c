@@ -5,65 +5,22 @@
  * Author : COMPUTER
  */
 
-#define F_CPU 14745600UL    // CPU 클럭 주파수 14.7456 MHz (본인 환경에 맞게 조정)
+#define F_CPU 14745600UL    // CPU 클럭 주파수 14.7456 MHz (본인 환경에 맞게 조정, 프로젝트 심볼 F_CPU와 같은 값)
 
 // AVR 표준 헤더
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
-
-// 7-세그먼트에 표시할 숫자별 LED 패턴 (공통 애노드 기준)
-unsigned char Font[18] = {
-    0x3F, 0x06, 0x5B, 0x4F,
-    0x66, 0x6D, 0x7C, 0x07,
-    0x7F, 0x67, 0x77, 0x7C,
-    0x39, 0x5E, 0x79, 0x71,
-    0x08, 0x80
-};
+#include <avr/sleep.h>
+#include "../../../Common/fndlayout/fndlayout.h"
 
 // 오른쪽 숫자 카운터 변수
-volatile int tr_cnt = 0;
-volatile int mr_cnt = 0;
+volatile unsigned int tr_cnt = 0;
+volatile unsigned int mr_cnt = 0;
 
 // 왼쪽 숫자 카운터 변수
-volatile int tl_cnt = 0;
-volatile int ml_cnt = 0;
-
-// 오른쪽 2자리 7-세그먼트 출력 함수
-void RSegment(int N)
-{
-    int i;
-    unsigned char N10 = N / 10;  // 십의 자리
-    unsigned char N1 = N % 10;   // 일의 자리
-
-    for (i = 0; i < 5; i++) {
-        PORTC = 0x0B;          // 오른쪽 3번째 자리 활성화 (PC3=0)
-        PORTA = Font[N10];     // 십의 자리 출력
-        _delay_ms(1);
-
-        PORTC = 0x07;          // 오른쪽 4번째 자리 활성화 (PC0=0)
-        PORTA = Font[N1];      // 일의 자리 출력
-        _delay_ms(1);
-    }
-}
-
-// 왼쪽 2자리 7-세그먼트 출력 함수
-void LSegment(int N)
-{
-    int i;
-    unsigned char N10 = N / 10;  // 십의 자리
-    unsigned char N1 = N % 10;   // 일의 자리
-
-    for (i = 0; i < 5; i++) {
-        PORTC = 0x0E;          // 왼쪽 1번째 자리 활성화 (PC1=0)
-        PORTA = Font[N10];     // 십의 자리 출력
-        _delay_ms(1);
-
-        PORTC = 0x0D;          // 왼쪽 2번째 자리 활성화 (PC2=0)
-        PORTA = Font[N1];      // 일의 자리 출력
-        _delay_ms(1);
-    }
-}
+volatile unsigned int tl_cnt = 0;
+volatile unsigned int ml_cnt = 0;
 
 // Timer0 Overflow 인터럽트 서비스 루틴
 ISR(TIMER0_OVF_vect)
@@ -91,11 +48,11 @@ ISR(TIMER0_COMP_vect)
 
 int main(void)
 {
-    // 포트 초기화
-    DDRA = 0xFF;      // PORTA : 7-세그먼트 LED 출력 (모두 출력 설정)
-    DDRC = 0x0F;      // PORTC 하위 4비트: 7-세그먼트 자리 선택 (출력)
-    PORTA = 0xFF;     // PORTA 초기값 (LED OFF, 공통 애노드)
-    PORTC = 0x0F;     // PORTC 초기값 (자리 모두 비활성화)
+    // 7-세그먼트: 화면을 좌우 2자리 뷰로 나눔 (프로젝트 심볼 FND_FRAME_HOOK=fndlayout_compose)
+    // 왼쪽은 앞자리 0을 끄고 10진수, 오른쪽은 16진수 (0x00 ~ 0x63)
+    fnd_init(FND_REFRESH_HZ);
+    fndlayout_add(0, 2, &ml_cnt, FNDLAYOUT_DEC | FNDLAYOUT_BLANK);
+    fndlayout_add(2, 2, &mr_cnt, FNDLAYOUT_HEX);
 
     DDRB = 0x10;      // PB4 (OC0) 출력 설정
 
@@ -118,9 +75,9 @@ int main(void)
 
     sei();            // 전역 인터럽트 활성화
 
+    set_sleep_mode(SLEEP_MODE_IDLE);  // 표시는 fnd 인터럽트가 담당하므로 메인 루프는 인터럽트 사이에 잠듦
     while (1)
     {
-        LSegment(ml_cnt);   // 왼쪽 숫자 표시
-        RSegment(mr_cnt);   // 오른쪽 숫자 표시
+        sleep_mode();
     }
 }
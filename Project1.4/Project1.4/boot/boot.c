@@ -0,0 +1,20 @@
+﻿#include "boot.h"
+
+boot_trace_t boot_trace;    // 부팅 단계별 타임스탬프
+
+// 부팅 단계 기록 함수 (첫 Idle까지 기록한 뒤에는 무시)
+void boot_mark(boot_phase_t phase) {
+	if (boot_trace.done) {
+		return;
+	}
+	boot_trace.stamp[phase] = timer_stamp();
+	if (phase == BOOT_PHASE_FIRST_IDLE) {
+		boot_trace.done = 1;
+	}
+}
+
+// 단계별 경과 시간(us)을 계산하는 함수
+// 1카운트 = 128 / 14.7456MHz = 625/72 us
+unsigned long boot_phase_us(boot_phase_t phase) {
+	return boot_trace.stamp[phase] * 625UL / 72;
+}
@@ -0,0 +1,31 @@
+﻿#ifndef BOOT_H_
+#define BOOT_H_
+
+#define F_CPU 14745600UL // 클럭 주파수 정의
+
+#include "../timer/timer.h"
+
+// 부팅 단계 (리셋 후 첫 안내 문구까지의 순서)
+typedef enum {
+	BOOT_PHASE_TIMER,       // 0: Timer0 시작 (모든 타임스탬프의 기준점, 리셋 직후)
+	BOOT_PHASE_PORTS,       // 1: LCD/키패드/LED 포트 설정 완료
+	BOOT_PHASE_LCD_READY,   // 2: LCD 전원 인가 대기 끝
+	BOOT_PHASE_LCD_INIT,    // 3: LCD 초기화 명령 완료
+	BOOT_PHASE_PROMPT,      // 4: "Input PassWord" 출력 완료
+	BOOT_PHASE_FIRST_IDLE,  // 5: 메인 루프의 첫 Idle 진입
+	BOOT_PHASE_COUNT
+} boot_phase_t;
+
+// 부팅 단계별 타임스탬프 (Timer0 카운트, 8.68us 단위)
+// 마지막 단계(첫 Idle)가 기록되면 done이 1이 되고 이후로는 바뀌지 않으므로, 디버거나 호스트에서 그대로 읽어 갈 수 있습니다.
+typedef struct {
+	unsigned long stamp[BOOT_PHASE_COUNT];
+	unsigned char done;
+} boot_trace_t;
+
+extern boot_trace_t boot_trace;
+
+void boot_mark(boot_phase_t phase);                 // 현재 시각을 phase의 타임스탬프로 기록
+unsigned long boot_phase_us(boot_phase_t phase);    // 리셋(Timer0 시작)부터 phase까지 걸린 시간 (us)
+
+#endif /* BOOT_H_ */
@@ -12,7 +12,7 @@ const char keypad_map[4][3] = {
 void Keypad_Init() {
 	KEYPAD_DDR = 0xF0;         // 상위 4비트 (컬럼) 출력, 하위 4비트 (행) 입력
 	// 처음에 모든 컬럼을 'Low'로 설정하여 초기 상태를 만듬
-	KEYPAD_PORT &= ~((1 << PD4) | (1 << PD5) | (1 << PD6) | (1 << PD7));
+	port_clear(KEYPAD_PORT, COL_ALL_PIN_MASK);
 }
 
 // keypad_get_char 함수: 키패드에서 눌린 버튼을 확인하는 함수
@@ -29,7 +29,7 @@ char keypad_get_char(void) {
 	// 각 컬럼을 순서대로 확인
 	for (int c = 0; c < 3; c++) {
 		// 컬럼을 선택하고, 다른 컬럼은 Low로 설정
-		KEYPAD_PORT = (KEYPAD_PORT & 0x0F) | col_select_pattern[c];
+		port_write(KEYPAD_PORT, COL_ALL_PIN_MASK, col_select_pattern[c]);
 		_delay_us(5); // 안정화 대기 시간
 
 		// 각 행에서 눌린 키 확인
@@ -40,7 +40,15 @@ char keypad_get_char(void) {
 	}
 
 	// 스캔 후 컬럼을 다시 모두 'Low'로 설정하여 초기 상태로 복귀
-	KEYPAD_PORT &= ~((1 << PD4) | (1 << PD5) | (1 << PD6) | (1 << PD7));
+	port_clear(KEYPAD_PORT, COL_ALL_PIN_MASK);
 
 	return key; // 눌린 키를 반환
 }
+
+// 파워다운 전에 호출하는 함수
+// 모든 컬럼(PD4~PD6)을 HIGH로 두면 어떤 키를 눌러도 해당 행(PD0~PD3 = INT0~INT3)이 HIGH가 되어 MCU를 깨웁니다.
+// 다음 keypad_get_char() 호출이 컬럼을 다시 하나씩 선택하므로 따로 되돌릴 필요는 없습니다.
+void keypad_wake_prepare(void) {
+	port_set(KEYPAD_PORT, COL0_PIN_MASK | COL1_PIN_MASK | COL2_PIN_MASK);
+	_delay_us(5); // 안정화 대기 시간
+}
@@ -7,32 +7,31 @@ void Port_Init(void) {
 }
 
 // LCD에 데이터를 전송하는 함수
+// RS/RW는 EN보다 먼저 안정되어 있어야 하므로(주소 설정 시간 40ns) EN과 따로 출력합니다.
 void LCD_Data(Byte ch) {
-	LCD_CTRL |= (1 << LCD_RS);  // RS=1 (데이터 모드)
-	LCD_CTRL &= ~(1 << LCD_RW); // RW=0 (쓰기 모드)
-	LCD_CTRL |= (1 << LCD_EN);  // EN High (데이터 전송 시작)
+	port_write(LCD_CTRL_PORT, LCD_CTRL_MASK, (1 << LCD_RS)); // RS=1 (데이터 모드), RW=0 (쓰기 모드), EN=0을 한 번에 출력
+	port_set(LCD_CTRL_PORT, (1 << LCD_EN));                  // EN High (데이터 전송 시작)
 	_delay_us(50); // 딜레이 (이 딜레이는 데이터 전송 완료 후 잠시 기다리는 시간)
-	LCD_WDATA = ch;             // 데이터 출력
+	port_write(LCD_DATA_PORT, 0xFF, ch);                     // 데이터 출력
 	_delay_us(50); // 다시 딜레이
-	LCD_CTRL &= ~(1 << LCD_EN); // EN Low (데이터 전송 완료)
+	port_clear(LCD_CTRL_PORT, (1 << LCD_EN));                // EN Low (데이터 전송 완료)
 }
 
 // LCD에 명령어를 전송하는 함수
 void LCD_Comm(Byte ch) {
-	LCD_CTRL &= ~(1 << LCD_RS); // RS=0 (명령 모드)
-	LCD_CTRL &= ~(1 << LCD_RW); // RW=0 (쓰기 모드)
-	LCD_CTRL |= (1 << LCD_EN);  // EN High (명령 전송 시작)
+	port_clear(LCD_CTRL_PORT, LCD_CTRL_MASK);                // RS=0 (명령 모드), RW=0 (쓰기 모드), EN=0을 한 번에 출력
+	port_set(LCD_CTRL_PORT, (1 << LCD_EN));                  // EN High (명령 전송 시작)
 	_delay_us(50); // 딜레이
-	LCD_WINST = ch;             // 명령어 출력
+	port_write(LCD_DATA_PORT, 0xFF, ch);                     // 명령어 출력
 	_delay_us(50); // 딜레이
-	LCD_CTRL &= ~(1 << LCD_EN); // EN Low (명령 전송 완료)
+	port_clear(LCD_CTRL_PORT, (1 << LCD_EN));                // EN Low (명령 전송 완료)
 }
 
 // LCD에 문자 하나를 출력하는 함수
 void LCD_CHAR(Byte c) {
 	// CGROM 문자코드의 0x31 ~ 0xFF는 아스키코드와 일치함
+	// 쓰기 실행 시간(41us)은 다음 쓰기의 EN High 구간(100us)이 보장하므로 따로 기다리지 않음
 	LCD_Data(c);  // 문자 데이터를 LCD로 출력
-	_delay_ms(1); // 출력 후 딜레이
 }
 
 // LCD에 문자열을 출력하는 함수
@@ -63,17 +62,12 @@ void LCD_Clear(void) {
 }
 
 // LCD 초기화 함수
+// 전원 인가 후 LCD_POWER_ON_MS가 지난 뒤에 호출해야 합니다. (그동안 다른 초기화를 먼저 하도록 대기는 호출하는 쪽에서)
+// 각 명령의 실행 시간(37us)은 LCD_Comm의 EN High 구간(100us)이 보장하므로 명령 사이에 따로 기다리지 않습니다.
 void LCD_Init(void) {
-	// LCD 초기화 과정 (이미 Port_Init에서 설정되었으므로 생략 가능)
-	// LCD_Comm(0x38); // 데이터 8비트 사용, 5X7도트, LCD 2열로 사용 (Function set)
-	_delay_ms(2);
-	LCD_Comm(0x38); // 함수 설정 (Function Set)
-	_delay_ms(2);
+	LCD_Comm(0x38); // 함수 설정 (Function Set): 데이터 8비트 사용, 5X7도트, LCD 2열로 사용
 	LCD_Comm(0x38); // 함수 설정 (Function Set) 재설정
-	_delay_ms(2);
 	LCD_Comm(0x0e); // Display ON, Cursor ON, Blink OFF (Display on/off control)
-	_delay_ms(2);
 	LCD_Comm(0x06); // Increment cursor, No display shift (Entry mode set)
-	_delay_ms(2);
 	LCD_Clear(); // LCD 화면 초기화
 }
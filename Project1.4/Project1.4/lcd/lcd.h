@@ -7,16 +7,21 @@
 // AVR 라이브러리 포함
 #include <avr/io.h>  // I/O 포트 정의
 #include <util/delay.h> // 지연 함수 (_delay_ms(), _delay_us() 등)
+#include "../port/port.h" // 포트 섀도 계층 (제어 핀을 한 번에 출력)
+#include "../pins/pins.h" // 보드 핀 배치표
 
-// LCD 핀 정의
-#define LCD_WDATA PORTC   // LCD 데이터 포트 (D0-D7)
-#define LCD_WINST PORTC   // LCD 명령어 포트 (데이터와 동일한 포트 사용)
-#define LCD_CTRL PORTG    // LCD 제어 포트 (RS, RW, EN)
+// LCD 핀 정의 (port.h의 섀도 포트 번호)
+#define LCD_DATA_PORT PORT_C  // LCD 데이터/명령어 포트 (D0-D7, PORTC)
+#define LCD_CTRL_PORT PORT_G  // LCD 제어 포트 (RS, RW, EN, PORTG)
 
 // 제어 핀 인덱스 정의
-#define LCD_RS 0   // RS 핀 인덱스 (PG0) -> 데이터 모드/명령 모드 선택
-#define LCD_RW 1   // RW 핀 인덱스 (PG1) -> 읽기/쓰기 모드 선택
-#define LCD_EN 2   // EN 핀 인덱스 (PG2) -> Enable 신호 (데이터 전송 활성화)
+#define LCD_RS PINS_LCD_RS   // RS 핀 인덱스 (PG0) -> 데이터 모드/명령 모드 선택
+#define LCD_RW PINS_LCD_RW   // RW 핀 인덱스 (PG1) -> 읽기/쓰기 모드 선택
+#define LCD_EN PINS_LCD_EN   // EN 핀 인덱스 (PG2) -> Enable 신호 (데이터 전송 활성화)
+#define LCD_CTRL_MASK ((1 << LCD_RS) | (1 << LCD_RW) | (1 << LCD_EN))
+
+// 전원 인가 후 첫 명령까지 기다려야 하는 시간 (HD44780 데이터시트, VCC 4.5V 기준 15ms)
+#define LCD_POWER_ON_MS 15
 
 // 바이트 타입 정의 (호환성 있는 unsigned char로 정의)
 #define Byte unsigned char
@@ -29,6 +34,6 @@ void LCD_CHAR(Byte);           // LCD에 문자 1개 출력 함수
 void LCD_STR(Byte*);           // LCD에 문자열 출력 함수
 void LCD_pos(unsigned char col, unsigned char row); // LCD 커서 위치 설정 함수 (col, row 순서)
 void LCD_Clear(void);          // LCD 화면 클리어 함수
-void LCD_Init(void);           // LCD 초기화 함수
+void LCD_Init(void);           // LCD 초기화 함수 (전원 인가 후 LCD_POWER_ON_MS 이후 호출)
 
 #endif /* LCD_H_ */
@@ -1,33 +1,91 @@
 ﻿#include "led.h"
 
+static unsigned long led_rgb;   // 마지막으로 설정한 색 (0xRRGGBB)
+
+// 색 마스크(LED_RED 등)를 24비트 색으로 바꾸는 함수
+static unsigned long led_mask_to_rgb(unsigned char color_mask) {
+	return ((color_mask & LED_RED) ? 0xFF0000UL : 0) |
+	       ((color_mask & LED_GREEN) ? 0x00FF00UL : 0) |
+	       ((color_mask & LED_BLUE) ? 0x0000FFUL : 0);
+}
+
+#if LED_DRIVER == LED_DRIVER_PWM
+#include <avr/pgmspace.h>
+#include "gamma16.h" // 감마 보정표 (8비트 밝기 → 16비트 듀티, make -C host tables로 생성)
+
+// 채널 하나의 8비트 밝기를 비교값으로 바꾸는 함수
+// 비반전 Fast PWM은 BOTTOM부터 비교 일치까지 HIGH(꺼짐)이므로, 밝을수록 비교값을 작게 합니다.
+// (비교값 = TOP이면 계속 HIGH라서 완전히 꺼짐)
+static uint16_t led_pwm_level(unsigned char value) {
+	uint16_t duty = pgm_read_word(&gamma16[value]) >> (16 - LED_PWM_BITS);
+	return (uint16_t)(LED_PWM_TOP - duty);
+}
+#endif
+
 // LED 초기화 함수
 void led_init(void) {
 	// LED 핀을 모두 출력으로 설정
-	LED_DDR |= ((1 << LED_RED_PIN) | (1 << LED_GREEN_PIN) | (1 << LED_BLUE_PIN));
+	LED_DDR |= LED_ALL_PINS;
+#if LED_DRIVER == LED_DRIVER_PWM
+	// 꺼진 상태의 비교값을 먼저 넣고 타이머를 시작
+	ICR3 = LED_PWM_TOP;
+	led_off();
+	TCCR3A = (1 << COM3A1) | (1 << COM3B1) | (1 << COM3C1) | (1 << WGM31); // OC3A/B/C 비반전 출력
+	TCCR3B = (1 << WGM33) | (1 << WGM32) | (1 << CS30);                    // Fast PWM (TOP = ICR3), 분주 없음
+#else
 	// 초기에는 모든 LED를 끈다 (Common Cathode 기준, HIGH로 출력)
 	led_off();
+#endif
 }
 
 // LED 색상 설정 함수
 void led_set_color(unsigned char color_mask) {
+#if LED_DRIVER == LED_DRIVER_PWM
+	led_set_rgb(led_mask_to_rgb(color_mask));
+#else
 	// Common Cathode 방식이므로, LED 핀이 LOW일 때 LED가 켜집니다.
-	// 먼저 모든 LED 핀을 HIGH로 설정하여 끄기
-	LED_PORT |= ((1 << LED_RED_PIN) | (1 << LED_GREEN_PIN) | (1 << LED_BLUE_PIN));
-
-	// 주어진 color_mask에 해당하는 핀만 LOW로 설정하여 LED를 켬
-	if (color_mask & (1 << LED_RED_PIN)) {
-		LED_PORT &= ~(1 << LED_RED_PIN); // 빨간색 LED 켜기
-	}
-	if (color_mask & (1 << LED_GREEN_PIN)) {
-		LED_PORT &= ~(1 << LED_GREEN_PIN); // 초록색 LED 켜기
-	}
-	if (color_mask & (1 << LED_BLUE_PIN)) {
-		LED_PORT &= ~(1 << LED_BLUE_PIN); // 파란색 LED 켜기
-	}
+	// LED 핀 중 켤 핀만 LOW, 나머지는 HIGH로 한 번에 출력 (다른 비트는 섀도 값 그대로)
+	port_write(LED_PORT, LED_ALL_PINS, ~color_mask);
+	led_rgb = led_mask_to_rgb(color_mask);
+#endif
+}
+
+// 24비트 색상 설정 함수 (0xRRGGBB)
+void led_set_rgb(unsigned long rgb) {
+#if LED_DRIVER == LED_DRIVER_PWM
+	unsigned int r = led_pwm_level((unsigned char)(rgb >> 16));
+	unsigned int g = led_pwm_level((unsigned char)(rgb >> 8));
+	unsigned int b = led_pwm_level((unsigned char)rgb);
+	unsigned char sreg = SREG;
+
+	// 16비트 레지스터는 TEMP 레지스터를 거쳐 두 번에 나눠 쓰므로, 그 사이에 같은 타이머를 쓰는 ISR이 끼어들지 않게 막습니다.
+	cli();
+	OCR3A = r;
+	OCR3B = g;
+	OCR3C = b;
+	led_rgb = rgb;
+	SREG = sreg;
+#else
+	// 켜기/끄기만 가능하므로 채널별로 절반 이상이면 켭니다.
+	led_set_color(((rgb & 0x800000UL) ? LED_RED : 0) |
+	              ((rgb & 0x008000UL) ? LED_GREEN : 0) |
+	              ((rgb & 0x000080UL) ? LED_BLUE : 0));
+	led_rgb = rgb;
+#endif
+}
+
+// 마지막으로 설정한 색을 읽는 함수 (GPIO 모드에서도 led_set_rgb()로 요청한 값 그대로)
+unsigned long led_get_rgb(void) {
+	return led_rgb;
 }
 
 // 모든 LED 끄는 함수
 void led_off(void) {
+#if LED_DRIVER == LED_DRIVER_PWM
+	led_set_rgb(LED_RGB_OFF);
+#else
 	// 모든 LED 핀을 HIGH로 설정하여 끄기 (Common Cathode 기준)
-	LED_PORT |= ((1 << LED_RED_PIN) | (1 << LED_GREEN_PIN) | (1 << LED_BLUE_PIN));
+	port_set(LED_PORT, LED_ALL_PINS);
+	led_rgb = LED_RGB_OFF;
+#endif
 }
@@ -5,15 +5,31 @@
 
 #include <avr/io.h>
 #include <util/delay.h>
+#include "../port/port.h" // 포트 섀도 계층 (LED 핀을 한 번에 출력, Timer0 ISR과 공유)
+#include "../pins/pins.h" // 보드 핀 배치표 (LED 핀 묶음과 구동 방식 LED_DRIVER 설정)
+
+// 구동 방식 (pins.h의 LED_DRIVER)
+//   LED_DRIVER_GPIO: 기본 PE0~PE2에 연결, 색마다 켜기/끄기만 가능 (7색)
+//   LED_DRIVER_PWM : PE3~PE5(OC3A/OC3B/OC3C)에 연결, Timer3 하드웨어 PWM으로 24비트 색상 표시
+//                    (한 번 설정하면 CPU 개입 없이 유지됨)
 
 // 풀컬러 LED 핀 정의 (연결 가이드에 맞게 설정)
-#define LED_PORT    PORTE   // LED 포트 (컬러 핀들을 연결할 포트)
+#define LED_PORT    PORT_E  // LED 포트 (컬러 핀들을 연결할 포트, port.h의 섀도 포트 번호)
 #define LED_DDR     DDRE    // LED 핀의 입출력 방향 설정
 
-// LED의 각 색상에 해당하는 핀
-#define LED_RED_PIN     PE0
-#define LED_GREEN_PIN   PE1
-#define LED_BLUE_PIN    PE2
+// LED의 각 색상에 해당하는 핀 (pins.h의 PINS_LED 묶음, PWM 모드는 OC3A/OC3B/OC3C)
+#define LED_RED_PIN     PINS_LED_RED
+#define LED_GREEN_PIN   PINS_LED_GREEN
+#define LED_BLUE_PIN    PINS_LED_BLUE
+#define LED_ALL_PINS    ((1 << LED_RED_PIN) | (1 << LED_GREEN_PIN) | (1 << LED_BLUE_PIN))
+
+// PWM 분해능 (8 ~ 16비트, Timer3 Fast PWM의 TOP = ICR3 = 2^비트 - 1)
+// 분주 없이 14.7456MHz로 세므로 10비트면 14.4kHz, 16비트면 225Hz입니다.
+#define LED_PWM_BITS    10
+#if LED_PWM_BITS < 8 || LED_PWM_BITS > 16
+#error "LED_PWM_BITS must be 8 to 16"
+#endif
+#define LED_PWM_TOP     ((1UL << LED_PWM_BITS) - 1)
 
 // 색상 정의 (Common Cathode 기준: 해당 핀이 LOW일 때 LED가 켜짐)
 #define LED_OFF     0x00 // 모든 LED 끄기
@@ -25,8 +41,15 @@
 #define LED_MAGENTA ((1 << LED_RED_PIN) | (1 << LED_BLUE_PIN)) // Red + Blue
 #define LED_WHITE   ((1 << LED_RED_PIN) | (1 << LED_GREEN_PIN) | (1 << LED_BLUE_PIN)) // Red + Green + Blue
 
+// 24비트 색상 정의 (0xRRGGBB, led_set_rgb()용)
+#define LED_RGB_OFF     0x000000UL
+#define LED_RGB_AMBER   0xFF7F00UL  // 호박색 (PWM 모드에서만 제대로 표시됨)
+#define LED_RGB_STANDBY 0x000010UL  // 대기 표시용 어두운 파랑 (PWM 모드에서만 켜짐)
+
 void led_init(void); // LED 초기화 함수
 void led_set_color(unsigned char color_mask); // LED 색상 설정 함수
+void led_set_rgb(unsigned long rgb); // 24비트 색상 설정 함수 (GPIO 모드에서는 채널별 128 이상이면 켜짐)
 void led_off(void); // 모든 LED 끄는 함수
+unsigned long led_get_rgb(void); // 마지막으로 설정한 색 (0xRRGGBB)
 
 #endif /* LED_H_ */
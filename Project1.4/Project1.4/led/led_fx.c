@@ -0,0 +1,219 @@
+﻿#include "led_fx.h"
+
+#include <avr/interrupt.h>
+
+#include "../timer/timer.h"
+
+// ---- 효과 정의 (플래시) ----
+static const led_frame_t led_fx_open[] PROGMEM = {
+	LED_FRAME(0x00FF00UL, 5000, LED_EASE_STEP),
+	LED_FRAME(0xFFFF00UL, 1000, LED_EASE_STEP),
+};
+static const led_frame_t led_fx_denied[] PROGMEM = {
+	LED_FRAME(0xFF0000UL, 2000, LED_EASE_STEP),
+	LED_FRAME(0xFFFF00UL, 1000, LED_EASE_STEP),
+};
+static const led_frame_t led_fx_changed[] PROGMEM = {
+	LED_FRAME(0x00FF00UL, 3000, LED_EASE_STEP),
+	LED_FRAME(0xFFFF00UL, 1000, LED_EASE_STEP),
+};
+static const led_frame_t led_fx_blink_red[] PROGMEM = {
+	LED_FRAME(0xFF0000UL, 250, LED_EASE_STEP),
+	LED_FRAME(0x000000UL, 250, LED_EASE_STEP),
+};
+static const led_frame_t led_fx_fade_out[] PROGMEM = {
+	LED_FRAME(0x000000UL, 500, LED_EASE_LINEAR),
+};
+static const led_frame_t led_fx_breathe[] PROGMEM = {
+	LED_FRAME(LED_RGB_STANDBY, 1000, LED_EASE_IN_OUT),
+	LED_FRAME(0x000000UL, 1000, LED_EASE_IN_OUT),
+};
+
+#define LED_FX(frames, repeat) { frames, sizeof(frames) / sizeof(frames[0]), repeat }
+
+static const led_effect_t led_effects[LED_FX_COUNT] PROGMEM = {
+	LED_FX(led_fx_open, 1),
+	LED_FX(led_fx_denied, 1),
+	LED_FX(led_fx_changed, 1),
+	LED_FX(led_fx_blink_red, 4),
+	LED_FX(led_fx_fade_out, 1),
+	LED_FX(led_fx_breathe, LED_FX_FOREVER),
+};
+
+// ---- 재생 상태 (틱 ISR과 공유) ----
+static volatile unsigned char led_fx_active;        // 효과 진행 중
+static const led_frame_t *led_fx_frames;            // 진행 중인 효과의 키프레임
+static unsigned char led_fx_count;
+static unsigned char led_fx_repeat;                 // 남은 반복 횟수 (LED_FX_FOREVER = 무한)
+static unsigned char led_fx_index;                  // 현재 키프레임 번호
+static unsigned int led_fx_left;                    // 현재 키프레임의 남은 틱 (0이 되면 다음 키프레임)
+static unsigned char led_fx_ease;
+static unsigned long led_fx_from;                   // 현재 키프레임의 출발 색
+static unsigned long led_fx_to;                     // 현재 키프레임의 목표 색
+static unsigned int led_fx_level[3];                // LINEAR: 채널별 현재 밝기 (8.8 고정소수점, B/G/R 순)
+static int led_fx_delta[3];                         // LINEAR: 채널별 1ms당 증가량 (8.8)
+static unsigned int led_fx_progress;                // IN_OUT: 진행률 (0 ~ 65535)
+static unsigned int led_fx_rate;                    // IN_OUT: 1ms당 진행률 증가량
+
+static unsigned char led_fx_queue[LED_FX_QUEUE_SIZE];
+static volatile unsigned char led_fx_queue_head;
+static volatile unsigned char led_fx_queue_count;
+
+// 색을 출력하는 함수 (같은 색이면 레지스터를 건드리지 않음)
+static void led_fx_output(unsigned long rgb) {
+	if (rgb != led_get_rgb()) {
+		led_set_rgb(rgb);
+	}
+}
+
+// 키프레임을 읽어 시작하는 함수
+// 한 틱 증가량은 여기서 곱셈으로 구해 두므로, 틱마다는 덧셈(LINEAR)이나 표 없는 보간(IN_OUT)만 합니다.
+// 색을 유지하는 프레임은 끝날 때까지 핸들러 호출 자체를 미룹니다.
+static void led_fx_enter_frame(void) {
+	const led_frame_t *frame = &led_fx_frames[led_fx_index];
+	unsigned int duration = pgm_read_word(&frame->duration_ms);
+	unsigned char c;
+
+	led_fx_from = led_get_rgb();
+	led_fx_to = pgm_read_dword(&frame->rgb);
+	led_fx_ease = pgm_read_byte(&frame->ease);
+	led_fx_rate = pgm_read_word(&frame->rate);
+	if (led_fx_ease == LED_EASE_STEP || led_fx_rate == 0) {
+		led_fx_output(led_fx_to);
+		led_fx_left = 1;
+		timer_defer_tick_handler(duration ? duration : 1);
+		return;
+	}
+	for (c = 0; c < 3; c++) {
+		unsigned char from = (unsigned char)(led_fx_from >> (c * 8));
+		int diff = (int)(unsigned char)(led_fx_to >> (c * 8)) - from;
+
+		led_fx_level[c] = (unsigned int)from << 8;
+		led_fx_delta[c] = (int)((long)diff * led_fx_rate / 256);   // 0 쪽으로 버려서 목표를 넘지 않음
+	}
+	led_fx_progress = 0;
+	led_fx_left = duration;
+	timer_defer_tick_handler(1);
+}
+
+// 효과를 처음부터 시작하는 함수 (인터럽트 금지 상태에서 호출)
+static void led_fx_start(led_fx_id_t id) {
+	const led_effect_t *fx = &led_effects[id];
+
+	led_fx_frames = (const led_frame_t *)pgm_read_ptr(&fx->frames);
+	led_fx_count = pgm_read_byte(&fx->count);
+	led_fx_repeat = pgm_read_byte(&fx->repeat);
+	led_fx_index = 0;
+	led_fx_active = 1;
+	led_fx_enter_frame();
+}
+
+// 효과가 끝났을 때: 예약된 효과가 있으면 이어서 시작
+static void led_fx_finish(void) {
+	led_fx_active = 0;
+	if (led_fx_queue_count > 0) {
+		unsigned char id = led_fx_queue[led_fx_queue_head];
+
+		led_fx_queue_head = (led_fx_queue_head + 1) % LED_FX_QUEUE_SIZE;
+		led_fx_queue_count--;
+		led_fx_start((led_fx_id_t)id);
+	}
+}
+
+// 두 색 사이를 f/256 지점에서 섞는 함수 (채널별 선형 보간)
+static unsigned long led_fx_mix(unsigned long from, unsigned long to, unsigned int f) {
+	unsigned long rgb = 0;
+	unsigned char shift;
+
+	for (shift = 0; shift <= 16; shift += 8) {
+		unsigned int a = (unsigned char)(from >> shift);
+		unsigned int b = (unsigned char)(to >> shift);
+		rgb |= (unsigned long)((a * (256 - f) + b * f) >> 8) << shift;
+	}
+	return rgb;
+}
+
+// 1ms 틱 핸들러 (Timer0 비교 일치 ISR에서 호출, 색 유지 중과 효과가 없을 때는 불리지 않음)
+static void led_fx_tick(void) {
+	if (!led_fx_active) {
+		timer_defer_tick_handler(TIMER_DEFER_FOREVER);  // 다음 led_play()까지 쉼
+		return;
+	}
+	if (--led_fx_left) {
+		if (led_fx_ease == LED_EASE_LINEAR) {
+			unsigned char c;
+
+			for (c = 0; c < 3; c++) {
+				led_fx_level[c] += led_fx_delta[c];
+			}
+			led_fx_output(((unsigned long)(led_fx_level[2] >> 8) << 16) |
+			              ((unsigned long)(led_fx_level[1] >> 8) << 8) | (led_fx_level[0] >> 8));
+		} else {
+			// 진행률 f (0~255)에 smoothstep(3f^2 - 2f^3)을 적용해 출발 색과 목표 색 사이를 출력
+			unsigned int f;
+
+			led_fx_progress += led_fx_rate;
+			f = led_fx_progress >> 8;
+			f = (unsigned int)(((unsigned long)f * f * (768 - 2 * f)) >> 16);
+			led_fx_output(led_fx_mix(led_fx_from, led_fx_to, f));
+		}
+		return;
+	}
+	// 키프레임 끝: 누적된 반올림 오차가 남지 않도록 목표 색을 확정하고 다음 키프레임으로
+	led_fx_output(led_fx_to);
+	if (++led_fx_index >= led_fx_count) {
+		led_fx_index = 0;
+		if (led_fx_repeat != LED_FX_FOREVER && --led_fx_repeat == 0) {
+			led_fx_finish();
+			return;
+		}
+	}
+	led_fx_enter_frame();
+}
+
+// 효과 엔진 초기화 함수
+void led_fx_init(void) {
+	led_fx_active = 0;
+	led_fx_queue_head = 0;
+	led_fx_queue_count = 0;
+	timer_set_tick_handler(led_fx_tick);
+}
+
+// 효과 즉시 시작 함수 (진행 중인 효과와 예약은 취소)
+void led_play(led_fx_id_t id) {
+	unsigned char sreg = SREG;
+
+	cli();
+	led_fx_queue_count = 0;
+	led_fx_start(id);
+	SREG = sreg;
+}
+
+// 효과 예약 함수 (진행 중인 효과가 없으면 바로 시작)
+void led_queue(led_fx_id_t id) {
+	unsigned char sreg = SREG;
+
+	cli();
+	if (!led_fx_active) {
+		led_fx_start(id);
+	} else if (led_fx_queue_count < LED_FX_QUEUE_SIZE) {
+		led_fx_queue[(led_fx_queue_head + led_fx_queue_count) % LED_FX_QUEUE_SIZE] = id;
+		led_fx_queue_count++;
+	}
+	SREG = sreg;
+}
+
+// 효과 정지 함수
+void led_stop(void) {
+	unsigned char sreg = SREG;
+
+	cli();
+	led_fx_active = 0;
+	led_fx_queue_count = 0;
+	SREG = sreg;
+}
+
+// 효과 진행 여부 확인 함수
+unsigned char led_playing(void) {
+	return led_fx_active;
+}
@@ -0,0 +1,54 @@
+﻿#ifndef LED_FX_H_
+#define LED_FX_H_
+
+#define F_CPU 14745600UL // 클럭 주파수 정의
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#include "led.h"
+
+// 키프레임 전환 방식
+#define LED_EASE_STEP       0   // 프레임 시작과 동시에 색을 바꾸고 duration 동안 유지
+#define LED_EASE_LINEAR     1   // 직전 색에서 이 색까지 duration 동안 일정한 속도로 변화
+#define LED_EASE_IN_OUT     2   // 천천히 출발해 천천히 도착 (smoothstep, 숨쉬기 효과용)
+
+#define LED_FX_QUEUE_SIZE   4   // 현재 효과 뒤에 예약할 수 있는 효과 수
+#define LED_FX_FOREVER      0   // repeat 값: 다른 효과로 교체될 때까지 반복
+
+// 키프레임 (플래시에 저장, LED_FRAME()으로 정의)
+typedef struct {
+	unsigned long rgb;          // 목표 색 (0xRRGGBB)
+	unsigned int duration_ms;   // 프레임 길이 (ms)
+	unsigned char ease;         // LED_EASE_x
+	unsigned int rate;          // 1ms당 진행률 (65536 / duration_ms, 0이면 바로 바뀜)
+} led_frame_t;
+
+// 키프레임 정의 매크로: 진행률 증가량을 컴파일할 때 나눗셈으로 구해 두므로 틱 ISR에서는 나눗셈을 하지 않습니다.
+#define LED_FRAME(rgb, ms, ease)    { (rgb), (ms), (ease), (unsigned int)((ms) > 1 ? 65536UL / (ms) : 0) }
+
+// 효과 = 키프레임 묶음 + 반복 횟수
+typedef struct {
+	const led_frame_t *frames;  // 플래시의 키프레임 배열
+	unsigned char count;        // 키프레임 수
+	unsigned char repeat;       // 반복 횟수 (LED_FX_FOREVER = 무한)
+} led_effect_t;
+
+// 효과 번호 (led_fx.c의 효과 표 순서와 같아야 함)
+typedef enum {
+	LED_FX_OPEN,        // 문 열림: 초록 5초 → 노랑 1초
+	LED_FX_DENIED,      // 인증 실패: 빨강 2초 → 노랑 1초
+	LED_FX_CHANGED,     // 비밀번호 변경 완료: 초록 3초 → 노랑 1초
+	LED_FX_BLINK_RED,   // 경고: 빨강 0.25초 간격 점멸 4회
+	LED_FX_FADE_OUT,    // 현재 색에서 0.5초 동안 꺼짐
+	LED_FX_BREATHE,     // 대기: 어두운 파랑으로 2초 주기 숨쉬기 (무한)
+	LED_FX_COUNT
+} led_fx_id_t;
+
+void led_fx_init(void);             // 효과 엔진 초기화 (timer_init() 이후, 1ms 틱 핸들러로 등록)
+void led_play(led_fx_id_t id);      // 진행 중인 효과와 예약을 모두 취소하고 바로 시작 (즉시 반환)
+void led_queue(led_fx_id_t id);     // 진행 중인 효과가 끝난 뒤 시작하도록 예약 (예약이 가득 차면 무시)
+void led_stop(void);                // 효과를 모두 멈춤 (LED는 마지막 색 유지)
+unsigned char led_playing(void);    // 진행 중이거나 예약된 효과가 있으면 1
+
+#endif /* LED_FX_H_ */
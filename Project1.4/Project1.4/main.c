@@ -17,6 +17,11 @@
 #include "lcd/lcd.h"            // LCD 제어 라이브러리 헤더 파일
 #include "keypad/keypad.h"         // 키패드 제어 라이브러리 헤더 파일
 #include "led/led.h"            // 풀컬러 LED 제어 라이브러리 헤더 파일
+#include "led/led_fx.h"         // LED 효과 엔진 헤더 파일 (1ms 틱으로 구동)
+#include "timer/timer.h"        // 1ms 타임베이스 (Timer0) 헤더 파일
+#include "power/power.h"        // 슬립 전원 관리 헤더 파일
+#include "boot/boot.h"          // 부팅 단계 타임스탬프 헤더 파일
+#include "port/port.h"          // 포트 섀도 계층 헤더 파일
 
 
 // =========================================================================
@@ -25,6 +30,8 @@
 
 #define MAX_PASSWORD_LENGTH 7 // 일반 비밀번호 및 새 비밀번호의 최대 길이 (7자리)
 
+#define POWER_DOWN_DELAY_MS 30000UL // 이 시간 동안 키 입력이 없으면 파워다운으로 들어갑니다 (30초)
+
 // 프로그램의 현재 상태를 나타내는 열거형 (Enum)
 typedef enum {
     PROGRAM_STATE_INPUT_PASSWORD,   // 0: 비밀번호 입력 대기 상태
@@ -54,6 +61,9 @@ char entered_password[MAX_PASSWORD_LENGTH + 1];
 // entered_password 버퍼에 현재까지 입력된 문자의 개수를 추적하는 인덱스
 int password_index = 0;
 
+// 결과 화면(OPEN 등)을 LED 효과가 끝날 때까지 유지하는 중인지 여부 (그동안 키 입력은 받지 않습니다)
+unsigned char result_showing = 0;
+
 
 // =========================================================================
 // 3. 함수 선언 (프로토타입은 일반적으로 헤더 파일에 있지만, main에서만 쓰는 보조 함수는 여기에)
@@ -68,6 +78,9 @@ void enter_admin_mode(void);
 // 비밀번호 변경 모드로 진입 시 LCD 메시지 및 상태 설정을 담당하는 함수
 void enter_change_password_mode(void);
 
+// 결과 화면을 LED 효과와 함께 보여주기 시작하는 함수
+void show_result(led_fx_id_t effect);
+
 
 // =========================================================================
 // 4. 함수 구현
@@ -122,32 +135,68 @@ void enter_change_password_mode(void) {
     memset(entered_password, 0, sizeof(entered_password)); // entered_password 버퍼를 지웁니다.
 }
 
+/**
+ * @brief 결과 화면의 LED 효과를 시작합니다. 효과가 끝나면 메인 루프가 reset_program()을 호출합니다.
+ *        (효과는 1ms 틱에서 진행되므로 기다리는 동안 CPU는 Idle 슬립에 들어갈 수 있습니다.)
+ */
+void show_result(led_fx_id_t effect) {
+    led_play(effect);
+    result_showing = 1;
+}
+
 /**
  * @brief 메인 함수: 프로그램의 시작점이며 무한 루프를 통해 시스템을 운영합니다.
  */
 int main(void) {
-    // 하드웨어 포트 방향 설정 (각 모듈의 초기화 함수에서 대부분 처리됩니다.)
-    // LED (PORTE)는 main에서 직접 DDR 설정
-    DDRE = 0x07; // PORTE의 PE0, PE1, PE2 핀을 출력으로 설정합니다 (풀컬러 LED 제어용).
-
-    // 각 모듈 (LCD, 키패드, LED) 초기화
+    // 부팅 시간의 대부분은 LCD 전원 인가 대기(15ms)이므로, 타이머를 가장 먼저 시작하고
+    // 나머지 초기화를 그 대기 시간 안에서 끝낸 뒤 남은 시간만 Idle 슬립으로 기다립니다.
+    port_init();    // 포트 섀도를 현재 출력 값으로 맞춤 (port.c에 정의되어 있음, 포트를 쓰는 모든 드라이버보다 먼저)
+    timer_init();   // 1ms 틱 타이머 시작 (timer.c에 정의되어 있음, 부팅 타임스탬프의 기준점)
+    boot_mark(BOOT_PHASE_TIMER);
+    sei(); // Global Interrupt Enable (1ms 틱 인터럽트와 슬립에서 깨우는 인터럽트에 필요)
+
+    // 각 모듈 (LCD, 키패드, LED) 포트 초기화
     Port_Init();    // LCD 포트 초기화 (lcd.c에 정의되어 있음)
-    LCD_Init();     // LCD 컨트롤러 초기화 (lcd.c에 정의되어 있음)
     Keypad_Init();  // 키패드 포트 초기화 (keypad.c에 정의되어 있음)
-    led_init();     // 풀컬러 LED 초기화 (led.c에 정의되어 있음)
-
-    sei(); // Global Interrupt Enable (필요하다면 활성화, 여기서는 폴링 방식이므로 필수 아님)
+    led_init();     // 풀컬러 LED 초기화 (led.c에 정의되어 있음, LED 핀 DDR 설정 포함)
+    led_fx_init();  // LED 효과 엔진을 1ms 틱에 연결 (led_fx.c에 정의되어 있음)
+    power_init();   // 슬립 체류 시간 통계 초기화 (power.c에 정의되어 있음)
+    boot_mark(BOOT_PHASE_PORTS);
+
+    // LCD 전원 인가 대기의 남은 시간 (틱이 0.998ms이므로 한 틱 더 기다림)
+    while (timer_millis() <= LCD_POWER_ON_MS) {
+        power_idle();
+    }
+    boot_mark(BOOT_PHASE_LCD_READY);
+    LCD_Init();     // LCD 컨트롤러 초기화 (lcd.c에 정의되어 있음)
+    boot_mark(BOOT_PHASE_LCD_INIT);
 
     reset_program(); // 프로그램 시작 시 초기 상태로 설정합니다.
+    boot_mark(BOOT_PHASE_PROMPT);
+
+    unsigned long last_key_ms = timer_millis(); // 마지막으로 키 처리를 마친 시각 (파워다운 진입 판단용)
 
     // 메인 무한 루프
     while (1) {
+        if (result_showing) { // 결과 화면을 보여주는 중이라면
+            if (led_playing()) { // LED 효과가 끝날 때까지 키를 읽지 않고 Idle 슬립으로 기다립니다.
+                power_idle_for(POWER_IDLE_FOREVER, 0, 0); // 효과는 틱 핸들러에서 끝나므로 핸들러가 불린 틱에만 깨어납니다.
+                continue;
+            }
+            result_showing = 0;
+            reset_program();                // 효과가 끝나면 프로그램 상태를 초기화합니다.
+            last_key_ms = timer_millis();
+        }
+
         char key = keypad_get_char(); // 키패드에서 눌린 키 값을 읽어옵니다. (없으면 '\0' 반환)
 
         if (key != '\0') { // 키가 입력되었다면
             // 키 디바운싱: 키 눌림이 여러 번 감지되는 것을 방지합니다.
             _delay_ms(50); // 키 눌림 감지 후 짧게 대기하여 채터링(chattering)을 무시합니다.
-            while (keypad_get_char() != '\0'); // 키가 떼어질 때까지 계속 키패드를 읽어 대기합니다.
+            while (keypad_get_char() != '\0') { // 키가 떼어질 때까지 대기합니다.
+                keypad_wake_prepare();           // 모든 컬럼을 HIGH로 두면 눌린 키의 행 핀이 HIGH이므로,
+                power_idle_for(POWER_IDLE_FOREVER, KEYPAD_WAKE_INT_MASK, POWER_EDGE_FALLING); // 키를 떼어 LOW가 될 때까지 Idle 슬립
+            }
             _delay_ms(50); // 키가 완전히 떼어진 것을 확인 후 짧게 대기합니다.
 
             // 현재 프로그램 상태에 따라 다른 동작을 수행합니다 (상태 머신).
@@ -170,20 +219,12 @@ int main(void) {
                                 LCD_Clear();                                // LCD를 지웁니다.
                                 LCD_pos(0, 0);                              // 커서를 첫 줄로 이동합니다.
                                 LCD_STR((unsigned char*)"OPEN");            // "OPEN" 메시지를 출력합니다.
-                                led_set_color(LED_GREEN);                   // 풀컬러 LED를 초록색으로 켭니다.
-                                _delay_ms(5000);                            // 5초 동안 유지합니다.
-                                led_set_color(LED_YELLOW);                  // LED를 노란색으로 변경합니다.
-                                _delay_ms(1000);                            // 1초 동안 유지합니다 (다음 루프를 위해 잠시).
-                                reset_program();                            // 프로그램 상태를 초기화합니다.
+                                show_result(LED_FX_OPEN);                   // LED 초록 5초 → 노랑 1초 후 초기화합니다.
                             } else { // 비밀번호가 일치하지 않는다면 (오답)
                                 LCD_Clear();                                // LCD를 지웁니다.
                                 LCD_pos(0, 0);                              // 커서를 첫 줄로 이동합니다.
                                 LCD_STR((unsigned char*)"Not PassWord");    // "Not PassWord" 메시지를 출력합니다.
-                                led_set_color(LED_RED);                     // 풀컬러 LED를 빨간색으로 켭니다.
-                                _delay_ms(2000);                            // 2초 동안 유지합니다.
-                                led_set_color(LED_YELLOW);                  // LED를 노란색으로 변경합니다.
-                                _delay_ms(1000);                            // 1초 동안 유지합니다.
-                                reset_program();                            // 프로그램 상태를 초기화합니다.
+                                show_result(LED_FX_DENIED);                 // LED 빨강 2초 → 노랑 1초 후 초기화합니다.
                             }
                         } 
                         // 입력된 길이가 관리자 비밀번호 길이(5자리)와 같다면
@@ -195,11 +236,7 @@ int main(void) {
                                 LCD_Clear();                                    // LCD를 지웁니다.
                                 LCD_pos(0, 0);                                  // 커서를 첫 줄로 이동합니다.
                                 LCD_STR((unsigned char*)"Not Admin PWD");       // "Not Admin PWD" 메시지를 출력합니다.
-                                led_set_color(LED_RED);                         // 풀컬러 LED를 빨간색으로 켭니다.
-                                _delay_ms(2000);                                // 2초 동안 유지합니다.
-                                led_set_color(LED_YELLOW);                      // LED를 노란색으로 변경합니다.
-                                _delay_ms(1000);                                // 1초 동안 유지합니다.
-                                reset_program();                                // 프로그램 상태를 초기화합니다.
+                                show_result(LED_FX_DENIED);                     // LED 빨강 2초 → 노랑 1초 후 초기화합니다.
                             }
                         }
                         else { // 비밀번호 길이가 조건에 맞지 않을 때 (7자리 또는 5자리 요구)
@@ -208,6 +245,8 @@ int main(void) {
                              LCD_pos(0, 1);                                    // 커서를 다시 두 번째 줄 시작 위치로 이동합니다.
                              LCD_STR((unsigned char*)"7 or 5 digits");         // "7 or 5 digits" 안내 메시지를 출력합니다.
                              _delay_ms(1000);                                  // 1초 동안 메시지를 보여줍니다.
+                             LCD_pos(0, 1);                                    // 커서를 다시 두 번째 줄 시작 위치로 이동합니다.
+                             LCD_STR((unsigned char*)"                ");      // 안내 메시지가 남지 않도록 두 번째 줄 16칸을 모두 공백으로 지웁니다.
                              LCD_pos(0, 1);                                    // 커서를 다시 입력 위치로 이동합니다.
                              // 이전에 입력된 숫자를 다시 표시하여 사용자가 이어서 입력할 수 있도록 합니다.
                              for(int i=0; i<password_index; i++) {
@@ -250,17 +289,15 @@ int main(void) {
                             LCD_Clear();                                // LCD를 지웁니다.
                             LCD_pos(0, 0);                              // 커서를 첫 줄로 이동합니다.
                             LCD_STR((unsigned char*)"PWD Changed!");    // "PWD Changed!" 메시지를 출력합니다.
-                            led_set_color(LED_GREEN);                   // 풀컬러 LED를 초록색으로 켭니다.
-                            _delay_ms(3000);                            // 3초 동안 유지합니다.
-                            led_set_color(LED_YELLOW);                  // LED를 노란색으로 변경합니다.
-                            _delay_ms(1000);                            // 1초 동안 유지합니다.
-                            reset_program();                            // 프로그램 상태를 초기화합니다.
+                            show_result(LED_FX_CHANGED);                // LED 초록 3초 → 노랑 1초 후 초기화합니다.
                         } else { // 7자리가 채워지지 않았을 때
                             LCD_pos(0, 1);                             // 커서를 두 번째 줄로 이동합니다.
                             LCD_STR((unsigned char*)"         ");       // 기존 입력 내용을 지우기 위해 공백을 출력합니다.
                             LCD_pos(0, 1);                             // 커서를 다시 두 번째 줄 시작 위치로 이동합니다.
                             LCD_STR((unsigned char*)"7 digits Req");  // "7 digits Req" 안내 메시지를 출력합니다.
                             _delay_ms(1000);                           // 1초 동안 메시지를 보여줍니다.
+                            LCD_pos(0, 1);                             // 커서를 다시 두 번째 줄 시작 위치로 이동합니다.
+                            LCD_STR((unsigned char*)"                "); // 안내 메시지가 남지 않도록 두 번째 줄 16칸을 모두 공백으로 지웁니다.
                             LCD_pos(0, 1);                             // 커서를 다시 입력 위치로 이동합니다.
                             // 이전에 입력된 숫자를 다시 표시하여 사용자가 이어서 입력할 수 있도록 합니다.
                             for(int i=0; i<password_index; i++) {
@@ -277,6 +314,22 @@ int main(void) {
                     }
                     break; // PROGRAM_STATE_CHANGE_PASSWORD 케이스 종료
             }
+            last_key_ms = timer_millis(); // 키 처리를 마친 시각을 기록합니다.
+        } else if (timer_millis() - last_key_ms >= POWER_DOWN_DELAY_MS && !led_playing()) {
+            // 오랫동안 입력이 없으면 파워다운으로 들어가 키를 누를 때까지 (INT0~3) 잠듭니다.
+            // (파워다운 중에는 틱이 멈추므로 LED 효과가 진행 중이면 끝날 때까지 기다립니다.)
+            keypad_wake_prepare();          // 모든 컬럼을 HIGH로 두어 어떤 키든 행 핀을 HIGH로 만들게 합니다.
+            power_down(KEYPAD_WAKE_INT_MASK);
+            last_key_ms = timer_millis();   // 깨어난 뒤 다시 대기 시간을 셉니다.
+        } else {
+            // 처리할 입력이 없으면 키를 누르거나 (INT0~3 상승 에지) 파워다운으로 넘어갈 시각까지 Idle 슬립으로 기다립니다.
+            // (LED 효과 때문에 파워다운을 미루는 중이면 효과가 끝나는 틱에 깨어납니다.)
+            unsigned long idle_ms = timer_millis() - last_key_ms;
+
+            boot_mark(BOOT_PHASE_FIRST_IDLE); // 첫 Idle에서 부팅 기록을 마감합니다. (이후 호출은 무시됨)
+            keypad_wake_prepare();
+            power_idle_for(idle_ms < POWER_DOWN_DELAY_MS ? POWER_DOWN_DELAY_MS - idle_ms : POWER_IDLE_FOREVER,
+                           KEYPAD_WAKE_INT_MASK, POWER_EDGE_RISING);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+﻿#ifndef PINS_H_
+#define PINS_H_
+
+#include <avr/io.h>
+
+// 보드 핀 배치표
+// 모든 모듈이 쓰는 핀(과 그 핀의 대체 기능)을 이 파일 한 곳에서 정하고, 각 모듈 헤더는 여기 값을 가져다 씁니다.
+// PIN_CLAIM(모듈, 포트, 비트)은 핀마다 열거 상수 pin_owner_Pxn을 하나 선언하므로, 같은 핀을 두 모듈이 차지하면
+//   error: redeclaration of enumerator 'pin_owner_PE0'
+// 오류로 빌드가 실패하고, 먼저 차지한 줄이 note로 함께 표시됩니다. (배선을 바꾸기 전에 컴파일러가 충돌을 잡음)
+
+// ---- 배치 설정 (Project Properties > Symbols 또는 -D 옵션으로 변경) ----
+
+// LED 구동 방식 (led.h)
+//   LED_DRIVER_GPIO: 색마다 켜기/끄기만 가능 (7색)
+//   LED_DRIVER_PWM : Timer3 하드웨어 PWM으로 24비트 색상 표시 (OC3A~OC3C 핀에만 가능)
+#define LED_DRIVER_GPIO 0
+#define LED_DRIVER_PWM  1
+#ifndef LED_DRIVER
+#define LED_DRIVER LED_DRIVER_GPIO
+#endif
+
+// LED 핀 묶음 (기본: GPIO 모드는 PE0~PE2, PWM 모드는 PE3~PE5)
+#define PINS_LED_PE0_2      0   // PE0(R), PE1(G), PE2(B)
+#define PINS_LED_PE3_5      1   // PE3(R), PE4(G), PE5(B) = OC3A, OC3B, OC3C
+#ifndef PINS_LED
+#if LED_DRIVER == LED_DRIVER_PWM
+#define PINS_LED PINS_LED_PE3_5
+#else
+#define PINS_LED PINS_LED_PE0_2
+#endif
+#endif
+
+// 시리얼 콘솔 (기본: 사용 안 함)
+//   USART0은 PE0/PE1을 쓰므로 LED를 PINS_LED_PE3_5로 옮겨야 함 (LED 선 3가닥만 옮기면 되고 보드 수정은 필요 없음)
+//   USART1은 PD2/PD3을 쓰므로 키패드 행(PD0~PD3)과 함께 쓸 수 없음
+#define PINS_CONSOLE_NONE   0
+#define PINS_CONSOLE_USART0 1   // RXD0 = PE0, TXD0 = PE1
+#define PINS_CONSOLE_USART1 2   // RXD1 = PD2, TXD1 = PD3
+#ifndef PINS_CONSOLE
+#define PINS_CONSOLE PINS_CONSOLE_NONE
+#endif
+
+// ---- 핀 번호 ----
+
+// LCD 제어 (PORTG)
+#define PINS_LCD_RS     PG0
+#define PINS_LCD_RW     PG1
+#define PINS_LCD_EN     PG2
+
+// 풀컬러 LED (PORTE)
+#if PINS_LED == PINS_LED_PE3_5
+#define PINS_LED_RED    PE3
+#define PINS_LED_GREEN  PE4
+#define PINS_LED_BLUE   PE5
+#elif PINS_LED == PINS_LED_PE0_2
+#if LED_DRIVER == LED_DRIVER_PWM
+#error "LED_DRIVER_PWM needs PINS_LED_PE3_5 (OC3A~OC3C)"
+#endif
+#define PINS_LED_RED    PE0
+#define PINS_LED_GREEN  PE1
+#define PINS_LED_BLUE   PE2
+#else
+#error "PINS_LED must be PINS_LED_PE0_2 or PINS_LED_PE3_5"
+#endif
+
+// ---- 핀 소유권 ----
+
+#define PIN_CLAIM(owner, port, bit)     PIN_CLAIM_(owner, port, bit)   // bit가 매크로여도 숫자로 펼친 뒤 이어 붙임
+#define PIN_CLAIM_(owner, port, bit)    enum { pin_owner_P##port##bit = 0, pin_##owner##_P##port##bit = 0 };
+
+// LCD: 데이터 버스 PORTC 전체, 제어 PG0~PG2
+PIN_CLAIM(lcd_data, C, 0)
+PIN_CLAIM(lcd_data, C, 1)
+PIN_CLAIM(lcd_data, C, 2)
+PIN_CLAIM(lcd_data, C, 3)
+PIN_CLAIM(lcd_data, C, 4)
+PIN_CLAIM(lcd_data, C, 5)
+PIN_CLAIM(lcd_data, C, 6)
+PIN_CLAIM(lcd_data, C, 7)
+PIN_CLAIM(lcd_rs, G, PINS_LCD_RS)
+PIN_CLAIM(lcd_rw, G, PINS_LCD_RW)
+PIN_CLAIM(lcd_en, G, PINS_LCD_EN)
+
+// 키패드: 행 PD0~PD3 (입력, 파워다운 중에는 INT0~INT3으로 깨우기), 컬럼 PD4~PD6, PD7은 출력 Low로 고정
+PIN_CLAIM(keypad_row_int0, D, 0)
+PIN_CLAIM(keypad_row_int1, D, 1)
+PIN_CLAIM(keypad_row_int2, D, 2)
+PIN_CLAIM(keypad_row_int3, D, 3)
+PIN_CLAIM(keypad_col, D, 4)
+PIN_CLAIM(keypad_col, D, 5)
+PIN_CLAIM(keypad_col, D, 6)
+PIN_CLAIM(keypad_unused_out, D, 7)
+
+// 풀컬러 LED (PWM 모드는 Timer3 비교 출력 핀 OC3A~OC3C가 고정이므로 핀 번호를 직접 적음)
+#if LED_DRIVER == LED_DRIVER_PWM
+PIN_CLAIM(led_red_oc3a, E, 3)
+PIN_CLAIM(led_green_oc3b, E, 4)
+PIN_CLAIM(led_blue_oc3c, E, 5)
+#else
+PIN_CLAIM(led_red, E, PINS_LED_RED)
+PIN_CLAIM(led_green, E, PINS_LED_GREEN)
+PIN_CLAIM(led_blue, E, PINS_LED_BLUE)
+#endif
+
+// 시리얼 콘솔
+#if PINS_CONSOLE == PINS_CONSOLE_USART0
+PIN_CLAIM(console_rxd0, E, 0)
+PIN_CLAIM(console_txd0, E, 1)
+#elif PINS_CONSOLE == PINS_CONSOLE_USART1
+PIN_CLAIM(console_rxd1, D, 2)
+PIN_CLAIM(console_txd1, D, 3)
+#elif PINS_CONSOLE != PINS_CONSOLE_NONE
+#error "PINS_CONSOLE must be PINS_CONSOLE_NONE, PINS_CONSOLE_USART0 or PINS_CONSOLE_USART1"
+#endif
+
+#endif /* PINS_H_ */
@@ -0,0 +1,12 @@
+﻿#include "port.h"
+
+volatile unsigned char port_shadow[PORT_COUNT]; // 포트별 출력 값 사본
+
+// 포트 섀도 초기화 함수
+// 리셋 직후에는 모든 PORTx가 0이라 섀도도 0이지만, 부트로더 등이 먼저 값을 썼을 수 있으므로 한 번 읽어 맞춥니다.
+void port_init(void) {
+	port_shadow[PORT_C] = PORTC;
+	port_shadow[PORT_D] = PORTD;
+	port_shadow[PORT_E] = PORTE;
+	port_shadow[PORT_G] = PORTG;
+}
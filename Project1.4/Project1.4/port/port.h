@@ -0,0 +1,90 @@
+﻿#ifndef PORT_H_
+#define PORT_H_
+
+#define F_CPU 14745600UL // 클럭 주파수 정의
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+// 포트 섀도 계층
+// 출력 포트(PORTx) 값의 사본(섀도)을 RAM에 두고, 드라이버는 섀도에서 여러 비트를 바꾼 뒤 포트에 한 번에 씁니다.
+//   - 포트를 읽어서 고쳐 쓰는(|=, &=) 대신 섀도를 고치므로 비트를 몇 개 바꾸든 포트 쓰기는 1번입니다.
+//     (PORTG처럼 sbi/cbi가 안 되는 확장 I/O 포트는 |= 한 번이 lds/ori/sts 3명령)
+//   - 여러 비트가 같은 순간에 바뀌므로 "모두 끈 뒤 하나씩 켜기" 같은 중간 상태가 핀에 나타나지 않습니다.
+//   - ISR에서도 쓰는 포트(PORT_ISR_SHARED)는 섀도 수정과 출력을 인터럽트를 막은 채 하므로,
+//     메인과 ISR이 같은 포트의 서로 다른 비트를 써도 한쪽의 변경이 사라지지 않습니다. 나머지 포트는 막지 않습니다.
+// 섀도를 쓰는 포트는 이 계층으로만 써야 합니다. (직접 쓴 값은 다음 쓰기에서 섀도 값으로 덮어써짐)
+typedef enum {
+	PORT_C,         // LCD 데이터 (D0 ~ D7)
+	PORT_D,         // 키패드 컬럼 (PD4 ~ PD7)
+	PORT_E,         // 풀컬러 LED (GPIO 모드)
+	PORT_G,         // LCD 제어 (RS, RW, EN)
+	PORT_COUNT
+} port_id_t;
+
+// ISR에서도 쓰는 포트: LED 효과 엔진이 Timer0 틱 인터럽트 안에서 LED(PORTE)를 바꿈
+#define PORT_ISR_SHARED     (1 << PORT_E)
+
+extern volatile unsigned char port_shadow[PORT_COUNT];
+
+void port_init(void);   // 섀도를 현재 포트 값으로 맞춤 (다른 드라이버 초기화보다 먼저 호출)
+
+// 값을 실제 포트에 출력 (id가 상수이면 switch는 컴파일 시간에 사라지고 out/sts 1명령이 됨)
+static inline void port_out(port_id_t id, unsigned char value) {
+	switch (id) {
+	case PORT_C: PORTC = value; break;
+	case PORT_D: PORTD = value; break;
+	case PORT_E: PORTE = value; break;
+	case PORT_G: PORTG = value; break;
+	default: break;
+	}
+}
+
+// mask 비트만 value로 바꿔 섀도에 기록 (포트에는 port_commit()에서 반영)
+static inline void port_stage(port_id_t id, unsigned char mask, unsigned char value) {
+	if (PORT_ISR_SHARED & (1 << id)) {
+		unsigned char sreg = SREG;
+
+		cli();
+		port_shadow[id] = (port_shadow[id] & ~mask) | (value & mask);
+		SREG = sreg;
+	} else {
+		port_shadow[id] = (port_shadow[id] & ~mask) | (value & mask);
+	}
+}
+
+// 지금까지 기록한 섀도를 포트에 한 번에 출력
+static inline void port_commit(port_id_t id) {
+	if (PORT_ISR_SHARED & (1 << id)) {
+		unsigned char sreg = SREG;
+
+		cli();
+		port_out(id, port_shadow[id]);
+		SREG = sreg;
+	} else {
+		port_out(id, port_shadow[id]);
+	}
+}
+
+// mask 비트만 value로 바꿔 바로 출력 (기록 + 출력을 한 번에, ISR 공유 포트는 그 사이에 인터럽트가 끼어들지 않음)
+static inline void port_write(port_id_t id, unsigned char mask, unsigned char value) {
+	if (PORT_ISR_SHARED & (1 << id)) {
+		unsigned char sreg = SREG;
+
+		cli();
+		value = (port_shadow[id] & ~mask) | (value & mask);
+		port_shadow[id] = value;
+		port_out(id, value);
+		SREG = sreg;
+	} else {
+		value = (port_shadow[id] & ~mask) | (value & mask);
+		port_shadow[id] = value;
+		port_out(id, value);
+	}
+}
+
+#define port_set(id, mask)      port_write((id), (mask), 0xFF)  // mask 비트를 HIGH로
+#define port_clear(id, mask)    port_write((id), (mask), 0x00)  // mask 비트를 LOW로
+#define port_get(id)            (port_shadow[(id)])             // 마지막으로 기록한 출력 값
+
+#endif /* PORT_H_ */
@@ -0,0 +1,117 @@
+﻿#include "power.h"
+
+power_stats_t power_stats;          // 모드별 체류 통계
+static unsigned long power_mark;    // 마지막 모드 전환 시각 (timer_stamp)
+
+// 지난 모드 전환 이후 시간을 mode의 체류 시간에 더하는 함수 (인터럽트 금지 상태에서 호출)
+static void power_account(power_mode_t mode) {
+	unsigned long now = timer_stamp();
+
+	power_stats.counts[mode] += now - power_mark;
+	power_mark = now;
+	while (power_stats.counts[mode] >= TIMER_COUNTS_PER_SEC) { // 나눗셈 없이 초 단위로 올림
+		power_stats.counts[mode] -= TIMER_COUNTS_PER_SEC;
+		power_stats.seconds[mode]++;
+	}
+}
+
+// 통계 초기화 함수
+void power_init(void) {
+	unsigned char i;
+
+	for (i = 0; i < POWER_MODE_COUNT; i++) {
+		power_stats.seconds[i] = 0;
+		power_stats.counts[i] = 0;
+		power_stats.entries[i] = 0;
+	}
+	power_mark = timer_stamp();
+}
+
+// int_mask의 INT0~3 핀을 edge 에지로 설정하고 인터럽트를 켜는 함수 (인터럽트 금지 상태에서 호출)
+// 핀이 이미 에지 뒤의 레벨이면 (상승: HIGH인 핀이 있음, 하강: 모두 LOW) 기다려도 에지가 오지 않으므로 0을 돌려줍니다.
+static unsigned char power_arm(unsigned char int_mask, unsigned char edge) {
+	unsigned char n, isc = 0, isc_mask = 0, level;
+
+	if (int_mask == 0) {
+		return 1;
+	}
+	for (n = 0; n < 4; n++) {
+		if (int_mask & (1 << n)) {
+			isc_mask |= (3 << (n * 2));
+			isc |= (edge << (n * 2));   // ISCn1:0
+		}
+	}
+	EICRA = (EICRA & ~isc_mask) | isc;
+	EIFR = int_mask;                    // 이전에 남은 플래그 지우기
+	EIMSK |= int_mask;
+
+	level = PIND & int_mask;
+	return (edge == POWER_EDGE_RISING) ? (level == 0) : (level != 0);
+}
+
+// Idle 슬립 함수
+void power_idle(void) {
+	power_idle_for(1, 0, 0);
+}
+
+// 조건부 Idle 슬립 함수
+// cli() 상태에서 준비한 뒤 sei() 바로 다음 명령으로 sleep을 실행하므로, 그 사이에 온 인터럽트를 놓치지 않습니다.
+// (sei() 직후 한 명령은 인터럽트보다 먼저 실행됨)
+// 깨어날 틱은 timer_wake_due에 두고, 틱 ISR(핸들러를 부른 틱)과 INT0~3 ISR이 지금 틱으로 당기면 루프를 끝냅니다.
+// 틱마다 깨어나도 레지스터를 건드리지 않고 다시 잠들므로, 체류 통계에는 한 번의 Idle로 기록됩니다.
+void power_idle_for(unsigned long ms, unsigned char int_mask, unsigned char edge) {
+	int_mask &= 0x0F;                   // INT0~3 (PD0~PD3)만 사용
+	cli();
+	timer_wake_due = timer_ticks + ms;  // 인터럽트를 켜기 전에 정해 두어야 ISR이 당긴 값이 남음
+	if (power_arm(int_mask, edge)) {
+		power_account(POWER_MODE_ACTIVE);
+		power_stats.entries[POWER_MODE_IDLE]++;
+		set_sleep_mode(SLEEP_MODE_IDLE);
+		sleep_enable();
+		while ((long)(timer_ticks - timer_wake_due) < 0) {
+			sei();
+			sleep_cpu();                // 1ms 틱 또는 외부 인터럽트까지 대기
+			cli();
+		}
+		sleep_disable();
+		power_account(POWER_MODE_IDLE);
+	}
+	if (int_mask) {
+		EIMSK &= ~int_mask;
+	}
+	sei();
+}
+
+// 파워다운 함수
+// INT0~3은 비동기로 감지되므로 파워다운에서도 에지로 깨어날 수 있습니다.
+// 깨울 핀이 이미 HIGH면 상승 에지가 오지 않으므로 잠들지 않고 바로 돌아갑니다.
+void power_down(unsigned char int_mask) {
+	int_mask &= 0x0F;                   // INT0~3 (PD0~PD3)만 사용
+	cli();
+	if (power_arm(int_mask, POWER_EDGE_RISING)) {
+		power_account(POWER_MODE_ACTIVE);
+		power_stats.entries[POWER_MODE_POWER_DOWN]++;
+		set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+		sleep_enable();
+		sei();
+		sleep_cpu();                    // INT0~3 상승 에지까지 대기 (Timer0 포함 모든 클럭 정지)
+		sleep_disable();
+		cli();
+		power_mark = timer_stamp();     // 파워다운 중의 시간은 측정할 수 없으므로 건너뜀
+	}
+
+	EIMSK &= ~int_mask;
+	sei();
+}
+
+// 모드별 체류 시간(ms)을 계산하는 함수
+unsigned long power_residency_ms(power_mode_t mode) {
+	return power_stats.seconds[mode] * 1000UL + power_stats.counts[mode] / TIMER_COUNTS_PER_TICK;
+}
+
+// 키패드 행 핀의 외부 인터럽트
+// 파워다운에서는 깨어나는 것이 목적이므로 할 일이 없고, power_idle_for()의 슬립 루프는 지금 틱에서 끝냅니다.
+ISR(INT0_vect) { timer_wake_due = timer_ticks; }
+ISR(INT1_vect) { timer_wake_due = timer_ticks; }
+ISR(INT2_vect) { timer_wake_due = timer_ticks; }
+ISR(INT3_vect) { timer_wake_due = timer_ticks; }
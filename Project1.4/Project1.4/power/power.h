@@ -0,0 +1,45 @@
+﻿#ifndef POWER_H_
+#define POWER_H_
+
+#define F_CPU 14745600UL // 클럭 주파수 정의
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "../timer/timer.h"
+
+// 전원 모드 (체류 시간 통계의 인덱스)
+typedef enum {
+	POWER_MODE_ACTIVE,      // 0: 코드 실행 중
+	POWER_MODE_IDLE,        // 1: Idle 슬립 (CPU만 정지, Timer0 틱 또는 외부 인터럽트로 깨어남)
+	POWER_MODE_POWER_DOWN,  // 2: 파워다운 (발진기 정지, 외부 인터럽트 INT0~3으로만 깨어남)
+	POWER_MODE_COUNT
+} power_mode_t;
+
+// power_idle_for()의 깨우는 에지 (EICRA의 ISCn1:0 값)
+#define POWER_EDGE_FALLING  2   // HIGH → LOW (키패드: 눌려 있던 키를 뗌)
+#define POWER_EDGE_RISING   3   // LOW → HIGH (키패드: 키를 누름)
+
+#define POWER_IDLE_FOREVER  TIMER_DEFER_FOREVER // power_idle_for(): 틱 핸들러나 외부 인터럽트가 깨울 때까지
+
+// 모드별 체류 통계
+// 파워다운 중에는 Timer0도 멈추므로 체류 시간은 셀 수 없고 진입 횟수만 기록됩니다.
+// (경과 시간 = seconds + counts / TIMER_COUNTS_PER_SEC)
+typedef struct {
+	unsigned long seconds[POWER_MODE_COUNT];    // 체류 시간 (초)
+	unsigned long counts[POWER_MODE_COUNT];     // 1초 미만 잔여 (Timer0 카운트, 8.68us)
+	unsigned long entries[POWER_MODE_COUNT];    // 진입 횟수
+} power_stats_t;
+
+extern power_stats_t power_stats;
+
+void power_init(void);                       // 통계 초기화 (timer_init() 이후 호출)
+void power_idle(void);                       // 다음 1ms 틱까지 Idle 슬립
+// ms틱 동안 Idle 슬립. 틱 핸들러가 불리거나 int_mask의 INT0~3 핀(PD0~PD3)에 edge 에지가 오면 먼저 돌아옴
+// (그 사이의 틱 ISR은 메인 루프로 돌아가지 않고 슬립 루프 안에서 바로 다시 잠듦)
+void power_idle_for(unsigned long ms, unsigned char int_mask, unsigned char edge);
+void power_down(unsigned char int_mask);     // int_mask의 INT0~3 핀(PD0~PD3) 상승 에지까지 파워다운
+unsigned long power_residency_ms(power_mode_t mode); // 모드별 체류 시간 (ms)
+
+#endif /* POWER_H_ */
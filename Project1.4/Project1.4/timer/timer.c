@@ -0,0 +1,73 @@
+﻿#include "timer.h"
+
+volatile unsigned long timer_ticks = 0; // 1ms 틱 카운터
+volatile unsigned long timer_handler_due = 0; // 틱 핸들러를 다음으로 부를 틱 (그 전의 틱은 카운터만 올림)
+volatile unsigned long timer_wake_due = 0; // 슬립 루프(power_idle_for)를 끝낼 틱 (그 전의 틱은 ISR에서 돌아가 바로 다시 잠듦)
+static volatile timer_handler_t timer_tick_handler; // 매 틱마다 호출할 함수
+
+// Timer0 초기화 함수 (CTC 모드, 1ms마다 비교 일치 인터럽트)
+void timer_init(void) {
+	TCCR0 = (1 << WGM01) | TIMER_CLOCK_SELECT; // CTC 모드 (TOP = OCR0), clk/128
+	OCR0 = TIMER_OCR_VALUE;                    // 115카운트마다 비교 일치
+	TCNT0 = 0;
+	TIMSK |= (1 << OCIE0);                     // 비교 일치 인터럽트 허용
+}
+
+// 틱 핸들러 등록 함수
+void timer_set_tick_handler(timer_handler_t handler) {
+	unsigned char sreg = SREG;
+
+	cli();
+	timer_tick_handler = handler;
+	timer_handler_due = timer_ticks + 1;
+	SREG = sreg;
+}
+
+// 핸들러 호출 미루기 함수 (핸들러 안 또는 인터럽트 금지 상태에서 호출)
+void timer_defer_tick_handler(unsigned long ticks) {
+	timer_handler_due = timer_ticks + ticks;
+}
+
+// 1ms 틱 인터럽트: 틱 카운터를 증가시키고 등록된 핸들러를 호출 (슬립 중이면 여기서 깨어남)
+// 핸들러가 호출을 미뤄 둔 동안에는 카운터만 올리고 바로 돌아갑니다.
+// 핸들러는 메인 루프가 기다리는 상태(LED 효과 종료 등)를 바꿀 수 있으므로, 호출한 틱에는 슬립 루프를 끝냅니다.
+ISR(TIMER0_COMP_vect) {
+	timer_handler_t handler = timer_tick_handler;
+
+	timer_ticks++;
+	if (handler && (long)(timer_ticks - timer_handler_due) >= 0) {
+		timer_handler_due = timer_ticks + 1;    // 기본은 다음 틱 (핸들러가 다시 미룰 수 있음)
+		handler();
+		timer_wake_due = timer_ticks;
+	}
+}
+
+// 경과 시간(ms)을 읽는 함수 (4바이트 변수이므로 인터럽트를 잠시 막고 읽음)
+unsigned long timer_millis(void) {
+	unsigned long ms;
+	unsigned char sreg = SREG;
+
+	cli();
+	ms = timer_ticks;
+	SREG = sreg;
+	return ms;
+}
+
+// Timer0 카운트 단위(8.68us) 타임스탬프를 읽는 함수
+// 틱 경계는 TCNT0가 OCR0에서 0으로 돌아가는 순간이며, OCF0도 그 클럭에 세워집니다.
+// (ISR이 아직 실행되지 않은 구간만 보정)
+unsigned long timer_stamp(void) {
+	unsigned long ticks;
+	unsigned char count;
+	unsigned char sreg = SREG;
+
+	cli();
+	ticks = timer_ticks;
+	count = TCNT0;
+	// 비교 일치 ISR이 아직 실행되지 않음 (단, TCNT0를 읽은 뒤에 0으로 돌아갔다면 count는 이전 틱의 값)
+	if ((TIFR & (1 << OCF0)) && count != TIMER_OCR_VALUE) {
+		ticks++;
+	}
+	SREG = sreg;
+	return ticks * TIMER_COUNTS_PER_TICK + count;
+}
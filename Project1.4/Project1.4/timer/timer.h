@@ -0,0 +1,32 @@
+﻿#ifndef TIMER_H_
+#define TIMER_H_
+
+#define F_CPU 14745600UL // 클럭 주파수 정의
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+// Timer0 CTC 모드 1ms 타임베이스
+// 14.7456MHz / 128분주 = 115200Hz, 115카운트마다 비교 일치 → 0.998ms (+0.17%, 어느 분주비로도 1ms가 나누어떨어지지 않음)
+#define TIMER_CLOCK_SELECT      ((1 << CS02) | (1 << CS00)) // clk/128 (Timer0는 CS0 = 101이 128분주)
+#define TIMER_OCR_VALUE         114                         // 0 ~ 114 (115카운트)
+#define TIMER_COUNTS_PER_TICK   (TIMER_OCR_VALUE + 1)       // 1ms당 카운트 수 (1카운트 = 8.68us)
+#define TIMER_COUNTS_PER_SEC    (TIMER_COUNTS_PER_TICK * 1000UL) // 1000틱 (체류 시간 통계의 '1초')
+
+#define TIMER_DEFER_FOREVER     0x7FFFFFFFUL                // timer_defer_tick_handler(): 다시 미룰 때까지 부르지 않음 (약 24일)
+
+extern volatile unsigned long timer_ticks; // 1ms 틱 카운터 (ISR에서 증가)
+extern volatile unsigned long timer_handler_due; // 틱 핸들러를 다음으로 부를 틱
+extern volatile unsigned long timer_wake_due; // power_idle_for()로 잠든 메인 루프를 깨울 틱 (핸들러를 부른 틱과 외부 인터럽트는 지금 틱으로 당김)
+
+typedef void (*timer_handler_t)(void);
+
+void timer_init(void);              // Timer0 1ms 틱 시작
+void timer_set_tick_handler(timer_handler_t handler); // 매 틱마다 ISR 안에서 호출할 함수 (짧게 끝나야 함, NULL이면 해제)
+// 다음 핸들러 호출을 지금부터 ticks틱 뒤로 미룸 (핸들러 안 또는 인터럽트 금지 상태에서 호출)
+// 색 유지 구간처럼 할 일이 없는 동안 ISR이 카운터만 올리고 돌아가게 합니다.
+void timer_defer_tick_handler(unsigned long ticks);
+unsigned long timer_millis(void);   // 리셋 후 경과 시간 (ms)
+unsigned long timer_stamp(void);    // 리셋 후 경과 시간 (Timer0 카운트 단위, 약 10시간마다 한 바퀴)
+
+#endif /* TIMER_H_ */
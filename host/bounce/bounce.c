@@ -0,0 +1,213 @@
+// =========================================================================
+// 파일명: bounce.c
+// 기능: Common/button 채터링 제거·이벤트 큐 검사 (가상 ATmega128, 16MHz, Common/tick의 Timer0 1ms 틱)
+//       - 입력 포트(PIND, 눌리면 0)에 정해 둔 파형을 가상 시각에 맞춰 넣고, 메인 루프가 button_get()으로
+//         꺼낸 이벤트를 시각과 함께 기록해 기대한 순서·종류·시각 범위와 비교합니다.
+//           * 튀면서 눌림/뗌: 마지막으로 튄 뒤 4번 연속 같은 샘플(15 ~ 20ms)에서 한 번만 PRESS/RELEASE
+//           * 길게 누름: PRESS 뒤 BUTTON_HOLD_MS에 HOLD 한 번
+//           * 10ms 글리치, 샘플 하나에 걸리는 2ms 스파이크, 마스크 밖 비트: 이벤트 없음
+//           * 두 버튼 동시 누름: 같은 샘플에서 둘 다
+//           * 메인 루프가 꺼내지 않는 동안의 큐 넘침: BUTTON_QUEUE_SIZE - 1개만 남고 나머지는 버림
+//           * button_post()로 넣은 키패드 문자
+//       - 하나라도 다르면 종료 코드 1을 반환합니다.
+//
+// 사용법: bounce [-q]   (-q: 이벤트 기록 없이 검사 결과만)
+// =========================================================================
+
+#include <stdio.h>
+#include <string.h>
+
+#include <avr/sleep.h>
+#include "sim.h"
+#include "timer0.h"
+#include "tick/tick.h"
+#include "button/button.h"
+
+#define MS                  1000000ULL  // 1ms (ns 단위)
+#define BOUNCE_MASK         0x0F        // 버튼으로 쓰는 비트 (PD0 ~ PD3)
+#define BOUNCE_PAUSE_FROM   4000        // 메인 루프가 이벤트를 꺼내지 않는 구간 (ms)
+#define BOUNCE_PAUSE_TO     5000
+#define BOUNCE_POST_AT      5200        // button_post()로 키패드 문자를 넣는 시각 (ms)
+#define BOUNCE_END          5500
+#define BOUNCE_MAX_EVENTS   64
+
+// 입력 파형: 이 시각(ms)부터 PIND 값 (눌린 비트가 0)
+// 샘플은 5ms의 배수 시각에 읽으므로, 튐이 샘플에 걸리도록 시각을 잡았습니다.
+typedef struct {
+    uint32_t ms;
+    uint8_t  pins;
+} bounce_step_t;
+
+static const bounce_step_t bounce_wave[] = {
+    // PD0: 튀면서 눌림 (105ms 샘플은 눌림, 110ms 샘플은 뗌, 마지막으로 튄 시각 112ms)
+    { 101, 0xFE }, { 108, 0xFF }, { 112, 0xFE },
+    // PD0: 길게 누른 뒤 같은 모양으로 튀면서 뗌 (마지막으로 튄 시각 1512ms)
+    { 1501, 0xFF }, { 1508, 0xFE }, { 1512, 0xFF },
+    // PD1, PD2: 10ms 글리치 (샘플 2번)
+    { 2001, 0xF9 }, { 2011, 0xFF },
+    // PD3: 샘플 하나에만 걸리는 2ms 스파이크 4번 (눌림과 뗌 샘플이 번갈아 나옴)
+    { 2204, 0xF7 }, { 2206, 0xFF }, { 2214, 0xF7 }, { 2216, 0xFF },
+    { 2224, 0xF7 }, { 2226, 0xFF }, { 2234, 0xF7 }, { 2236, 0xFF },
+    // PD5: 마스크 밖 비트 (3ms마다 뒤집힘)
+    { 2501, 0xDF }, { 2504, 0xFF }, { 2507, 0xDF }, { 2510, 0xFF }, { 2513, 0xDF }, { 2516, 0xFF },
+    // PD1 + PD3: 동시에 300ms 누름
+    { 3001, 0xF5 }, { 3301, 0xFF },
+    // PD2: 이벤트를 꺼내지 않는 동안 50ms 누름 / 50ms 뗌 6번 (이벤트 12개)
+    { 4101, 0xFB }, { 4151, 0xFF }, { 4201, 0xFB }, { 4251, 0xFF }, { 4301, 0xFB }, { 4351, 0xFF },
+    { 4401, 0xFB }, { 4451, 0xFF }, { 4501, 0xFB }, { 4551, 0xFF }, { 4601, 0xFB }, { 4651, 0xFF },
+};
+#define BOUNCE_STEPS        (sizeof(bounce_wave) / sizeof(bounce_wave[0]))
+
+// 기대 이벤트: 순서대로, 꺼낸 시각이 [from, to] ms 안
+typedef struct {
+    uint8_t  type;
+    uint8_t  code;
+    uint32_t from, to;
+    const char *what;
+} bounce_expect_t;
+
+static const bounce_expect_t bounce_expected[] = {
+    { BUTTON_PRESS,   0, 127, 132, "bouncy press, 15-20 ms after the last bounce" },
+    { BUTTON_HOLD,    0, 927 + BUTTON_HOLD_MS - 800, 932 + BUTTON_HOLD_MS - 800, "hold, BUTTON_HOLD_MS after the press" },
+    { BUTTON_RELEASE, 0, 1527, 1532, "bouncy release, 15-20 ms after the last bounce" },
+    { BUTTON_PRESS,   1, 3015, 3021, "two buttons pressed together" },
+    { BUTTON_PRESS,   3, 3015, 3021, "  (same sample)" },
+    { BUTTON_RELEASE, 1, 3315, 3321, "two buttons released together" },
+    { BUTTON_RELEASE, 3, 3315, 3321, "  (same sample)" },
+    { BUTTON_PRESS,   2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "queue full: 7 of 12 events kept" },
+    { BUTTON_RELEASE, 2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "" },
+    { BUTTON_PRESS,   2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "" },
+    { BUTTON_RELEASE, 2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "" },
+    { BUTTON_PRESS,   2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "" },
+    { BUTTON_RELEASE, 2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "" },
+    { BUTTON_PRESS,   2, BOUNCE_PAUSE_TO, BOUNCE_PAUSE_TO + 1, "" },
+    { BUTTON_PRESS, '5', BOUNCE_POST_AT, BOUNCE_POST_AT + 1, "keypad character from button_post()" },
+};
+#define BOUNCE_EXPECTED     (sizeof(bounce_expected) / sizeof(bounce_expected[0]))
+
+typedef struct {
+    uint32_t ms;
+    button_event_t e;
+} bounce_log_t;
+
+typedef struct {
+    unsigned     step;                  // 다음에 넣을 파형 단계
+    bounce_log_t log[BOUNCE_MAX_EVENTS];
+    int          count;
+} bounce_t;
+
+static bounce_t bounce;
+
+static const char *bounce_type_name(uint8_t type) {
+    return type == BUTTON_PRESS ? "PRESS" : type == BUTTON_RELEASE ? "RELEASE" : type == BUTTON_HOLD ? "HOLD" : "?";
+}
+
+// -------------------------------------------------------------------------
+// 1. 입력 파형 (sim_periph_t): 펌웨어는 button_init()에 넘긴 PIND 주소를 직접 읽으므로 레지스터 값을 바로 바꿈
+// -------------------------------------------------------------------------
+
+static uint64_t bounce_next(sim_unit_t *u, void *ctx) {
+    const bounce_t *b = (const bounce_t *)ctx;
+    (void)u;
+    return b->step < BOUNCE_STEPS ? bounce_wave[b->step].ms * MS : SIM_NEVER;
+}
+
+static void bounce_event(sim_unit_t *u, void *ctx) {
+    bounce_t *b = (bounce_t *)ctx;
+
+    u->io[SIM_ADDR_PIND] = bounce_wave[b->step++].pins;
+    u->seen[SIM_ADDR_PIND] = u->io[SIM_ADDR_PIND];
+}
+
+static const sim_periph_t bounce_periph = {
+    "bounce",
+    0,
+    0,
+    bounce_next,
+    bounce_event
+};
+
+// -------------------------------------------------------------------------
+// 2. 메인 루프: 틱마다 깨어나 이벤트를 꺼내 기록 (꺼내지 않는 구간 제외)
+// -------------------------------------------------------------------------
+
+static int bounce_main(void) {
+    sim_unit_t *u = sim_cur;
+    button_event_t e;
+    uint8_t posted = 0;
+
+    PORTD = 0xFF;                       // 풀업 (보드에서 하던 설정, 입력 값은 파형이 정함)
+    tick_init();
+    button_init(&PIND, BOUNCE_MASK);
+    sei();
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    for (;;) {
+        uint32_t ms = (uint32_t)(u->now_ns / MS);
+
+        if (ms >= BOUNCE_END) {
+            sim_stop(u);
+        }
+        if (!posted && ms >= BOUNCE_POST_AT) {
+            button_post(BUTTON_PRESS, '5');
+            posted = 1;
+        }
+        if (ms < BOUNCE_PAUSE_FROM || ms >= BOUNCE_PAUSE_TO) {
+            while (button_get(&e)) {
+                if (bounce.count < BOUNCE_MAX_EVENTS) {
+                    bounce.log[bounce.count].ms = ms;
+                    bounce.log[bounce.count].e = e;
+                    bounce.count++;
+                }
+            }
+        }
+        sleep_mode();
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    static sim_unit_t unit;
+    static timer0_t timer0;
+    int quiet = argc > 1 && strcmp(argv[1], "-q") == 0;
+    int failures = 0;
+
+    sim_unit_init(&unit, F_CPU);
+    sim_bind_vectors(&unit);
+    unit.io[SIM_ADDR_PIND] = 0xFF;      // 아무 버튼도 누르지 않음
+    unit.seen[SIM_ADDR_PIND] = 0xFF;
+    timer0_init(&timer0);
+    sim_attach(&unit, &timer0_periph, &timer0);
+    sim_attach(&unit, &bounce_periph, &bounce);
+
+    if (sim_run(&unit, bounce_main)) {
+        fprintf(stderr, "bounce: main loop returned\n");
+        return 1;
+    }
+
+    printf("sampling       : every %d ms, hold %d ms, queue %d slots, mask 0x%02X\n", BUTTON_SAMPLE_MS,
+           BUTTON_HOLD_MS, BUTTON_QUEUE_SIZE, BOUNCE_MASK);
+    for (unsigned i = 0; i < BOUNCE_EXPECTED || (int)i < bounce.count; i++) {
+        const bounce_expect_t *x = i < BOUNCE_EXPECTED ? &bounce_expected[i] : 0;
+        const bounce_log_t *l = (int)i < bounce.count ? &bounce.log[i] : 0;
+        char got[32] = "-", want[32] = "-";
+        int ok;
+
+        if (l) {
+            snprintf(got, sizeof(got), "%-7s %-3u %5u ms", bounce_type_name(l->e.type), l->e.code, l->ms);
+        }
+        if (x) {
+            snprintf(want, sizeof(want), "%-7s %-3u %u-%u ms", bounce_type_name(x->type), x->code, x->from, x->to);
+        }
+        ok = l && x && l->e.type == x->type && l->e.code == x->code && l->ms >= x->from && l->ms <= x->to;
+        if (!ok) {
+            failures++;
+        }
+        if (!ok || !quiet) {
+            printf("  %-4s  %-22s  expected %-24s %s\n", ok ? "ok" : "FAIL", got, want, x ? x->what : "unexpected event");
+        }
+    }
+    printf("isr calls      : %llu\n", (unsigned long long)unit.isr_calls);
+    printf("checks         : %u, failures %d\n", (unsigned)(BOUNCE_EXPECTED > (unsigned)bounce.count ? BOUNCE_EXPECTED : (unsigned)bounce.count),
+           failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+// =========================================================================
+// 파일명: drift.c
+// 기능: Common/tick + Common/stopwatch 장시간 정확도 검사 (가상 ATmega128, 14.7456MHz)
+//       - 14.7456MHz에서는 1ms가 230.4카운트라 소수 보정 없이 230카운트 CTC로 돌리면 틱이 0.17% 빨라
+//         3시간에 약 19초를 더 셉니다. tick 모듈은 남는 소수를 누적해 한 카운트 긴 주기를 섞으므로(tick.h)
+//         몇 시간을 돌려도 수정 발진자 오차(여기서는 0)만큼만 어긋나야 합니다.
+//       - 메인 루프는 Day10/Timer9처럼 1ms 틱마다 깨어나 stopwatch_show()를 부르고 Idle 슬립으로 돌아갑니다.
+//       - 검사 시점마다 stopwatch_elapsed()와 가상 시각의 차이, 보정이 없을 때의 오차(계산값)를 출력하고,
+//         화면을 다시 그린 횟수가 보이는 값이 바뀐 횟수와 같은지 확인합니다. (STOPWATCH_AUTO)
+//       - 오차가 틱 하나(1ms)를 넘거나 다시 그린 횟수가 다르면 종료 코드 1을 반환합니다.
+//
+// 사용법: drift [-t 시간(h)] [-c 검사횟수]
+// =========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <avr/sleep.h>
+#include "sim.h"
+#include "timer0.h"
+#include "tick/tick.h"
+#include "stopwatch/stopwatch.h"
+
+#define MS                  1000000ULL  // 1ms (ns 단위)
+#define DRIFT_MAX_CHECKS    64
+#define DRIFT_PLAIN_CYCLES  ((TICK_OCR_VALUE + 1) * 64.0)   // 소수 보정이 없을 때 틱 한 주기 (CPU 클럭)
+
+typedef struct {
+    stopwatch_t   sw;
+    uint64_t      at[DRIFT_MAX_CHECKS];     // 검사 시각 (ns)
+    uint64_t      seen_ns[DRIFT_MAX_CHECKS];    // 실제로 검사한 시각 (검사 시각 뒤 첫 깨어남)
+    unsigned long elapsed[DRIFT_MAX_CHECKS];    // 그때의 stopwatch_elapsed() (ms)
+    int           count;
+    int           step;
+    uint64_t      shows;                    // stopwatch_show() 호출 수
+    uint64_t      draws;                    // 그중 화면을 다시 그린 수
+} drift_t;
+
+static drift_t drift;
+
+// 메인 루프: 틱마다 깨어나 표시를 갱신하고, 검사 시각이 지났으면 경과 시간을 기록
+static int drift_main(void) {
+    sim_unit_t *u = sim_cur;
+
+    tick_init();
+    stopwatch_reset(&drift.sw);
+    stopwatch_start(&drift.sw);
+    sei();
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    for (;;) {
+        unsigned char valid = drift.sw.valid;
+        unsigned long from = drift.sw.shown_from;
+        unsigned int span = drift.sw.shown_span;
+
+        stopwatch_show(&drift.sw, STOPWATCH_AUTO);
+        drift.shows++;
+        if (!valid || drift.sw.shown_from != from || drift.sw.shown_span != span) {
+            drift.draws++;
+        }
+        if (u->now_ns >= drift.at[drift.step]) {
+            drift.seen_ns[drift.step] = u->now_ns;
+            drift.elapsed[drift.step] = stopwatch_elapsed(&drift.sw);
+            if (++drift.step == drift.count) {
+                sim_stop(u);
+            }
+        }
+        sleep_mode();
+    }
+    return 0;
+}
+
+// 0 ~ ms 동안 STOPWATCH_AUTO가 보여 주는 값의 수 (1/100초 → 초 → 분 단위로 바뀜)
+static uint64_t drift_expected_draws(uint64_t ms) {
+    if (ms < 60000) {
+        return ms / 10 + 1;
+    }
+    if (ms < 6000000) {
+        return 6000 + (ms - 60000) / 1000 + 1;
+    }
+    return 6000 + 5940 + (ms - 6000000) / 60000 + 1;
+}
+
+int main(int argc, char **argv) {
+    static sim_unit_t unit;
+    static timer0_t timer0;
+    double hours = 3.0, worst = 0.0;
+    struct timespec t0, t1;
+    int opt, failures = 0;
+
+    drift.count = 6;
+    while ((opt = getopt(argc, argv, "t:c:")) != -1) {
+        switch (opt) {
+            case 't': hours = atof(optarg); break;
+            case 'c': drift.count = atoi(optarg); break;
+            default: hours = 0; break;
+        }
+    }
+    if (hours <= 0 || drift.count < 1 || drift.count > DRIFT_MAX_CHECKS) {
+        fprintf(stderr, "usage: %s [-t hours] [-c checks (1-%d)]\n", argv[0], DRIFT_MAX_CHECKS);
+        return 2;
+    }
+    for (int i = 0; i < drift.count; i++) {
+        drift.at[i] = (uint64_t)(hours * 3600e9 * (i + 1) / drift.count);
+    }
+
+    sim_unit_init(&unit, F_CPU);
+    sim_bind_vectors(&unit);
+    timer0_init(&timer0);
+    sim_attach(&unit, &timer0_periph, &timer0);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (sim_run(&unit, drift_main)) {
+        fprintf(stderr, "drift: main loop returned\n");
+        return 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    printf("clock          : %.4f MHz, tick %lu + %lu/1000 counts of clk/64 (%.0f cycles uncorrected)\n",
+           F_CPU / 1e6, (unsigned long)TICK_OCR_VALUE + 1, (unsigned long)TICK_FRAC, DRIFT_PLAIN_CYCLES);
+    printf("%-14s   %12s   %10s   %12s\n", "virtual time", "stopwatch ms", "error ms", "uncorrected");
+    for (int i = 0; i < drift.count; i++) {
+        double true_ms = (double)drift.seen_ns[i] / MS;
+        double err = (double)drift.elapsed[i] - true_ms;
+        double plain = (double)drift.seen_ns[i] / 1e9 * F_CPU / DRIFT_PLAIN_CYCLES - true_ms;
+        uint64_t ms = (drift.seen_ns[i] + MS / 2) / MS;
+        uint64_t s = ms / 1000;
+
+        if (err < 0 ? -err > worst : err > worst) {
+            worst = err < 0 ? -err : err;
+        }
+        printf("%5llu:%02llu:%02llu.%03llu   %12lu   %+10.3f   %+10.3f s\n", (unsigned long long)(s / 3600),
+               (unsigned long long)(s / 60 % 60), (unsigned long long)(s % 60),
+               (unsigned long long)(ms % 1000), drift.elapsed[i], err, plain / 1e3);
+    }
+
+    uint64_t expected = drift_expected_draws(drift.elapsed[drift.count - 1]);
+    double wall_s = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("redraws        : %llu of %llu stopwatch_show() calls, %llu visible values\n",
+           (unsigned long long)drift.draws, (unsigned long long)drift.shows, (unsigned long long)expected);
+    printf("wall time      : %.3f s for %.1f h, %llu ISRs\n", wall_s, hours, (unsigned long long)unit.isr_calls);
+    if (worst >= 1.0) {
+        printf("  FAIL    error %.3f ms is more than one tick\n", worst);
+        failures++;
+    }
+    if (drift.draws != expected) {
+        printf("  FAIL    %llu redraws for %llu visible values\n", (unsigned long long)drift.draws,
+               (unsigned long long)expected);
+        failures++;
+    }
+    printf("checks         : 2, failures %d\n", failures);
+    return failures ? 1 : 0;
+}
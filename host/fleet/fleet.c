@@ -0,0 +1,549 @@
+// =========================================================================
+// 파일명: fleet.c
+// 기능: 수천 대의 가상 도어락(Project1.4 펌웨어)을 모든 코어에서 동시에 실행하는 플릿 시뮬레이터
+//       - 펌웨어는 공유 라이브러리(libfw.so)로 빌드하고, 작업 스레드마다 파일 복사본을 따로 dlopen 하여
+//         전역 변수(RAM)가 스레드 사이에 공유되지 않도록 합니다.
+//       - 유닛을 실행하기 전에 그 복사본의 쓰기 가능 영역을 로드 직후 이미지로 되돌리므로,
+//         유닛마다 리셋 직후의 RAM과 자신만의 레지스터 파일(sim_unit_t)을 가집니다.
+//       - 스케줄러는 작업 훔치기(work stealing) 방식: 스레드마다 유닛 번호 구간을 가지고 앞에서부터
+//         꺼내 쓰며, 자기 구간이 비면 다른 스레드 구간의 뒤쪽 절반을 가져옵니다.
+//       - 유닛마다 무작위 방문 시나리오(정상/오답/오타 수정/관리자/비밀번호 변경)를 생성하고,
+//         열림·거부·관리자 진입 횟수와 '#' 입력부터 결과 화면까지의 지연 분포를 집계합니다.
+//
+// 사용법: fleet [-n 유닛수] [-t 유닛당 가상 초] [-j 스레드수] [-s 시드] [-f libfw.so]
+// =========================================================================
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <link.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sim.h"
+#include "timer0.h"
+#include "lockboard.h"
+
+#define FLEET_F_CPU         14745600UL
+#define FLEET_MAX_THREADS   256
+#define FLEET_MAX_REGIONS   4
+#define FLEET_HIST_BUCKETS  256         // 지연 히스토그램: 1ms 단위 0~254ms, 마지막 칸은 255ms 이상
+#define MS                  1000000ULL
+
+#define ADMIN_PASSWORD      "98765"     // main.c의 ADMIN_PASSWORD와 동일
+#define INITIAL_PASSWORD    "1234567"   // main.c의 stored_password 초기값과 동일
+
+// -------------------------------------------------------------------------
+// 1. 통계
+// -------------------------------------------------------------------------
+
+typedef struct {
+    uint64_t units;
+    uint64_t visits;
+    uint64_t keys;
+    uint64_t opens;             // "OPEN"
+    uint64_t denied;            // "Not PassWord"
+    uint64_t admin_denied;      // "Not Admin PWD"
+    uint64_t admin_entries;     // "Admin Mode"
+    uint64_t pwd_changes;       // "PWD Changed!"
+    uint64_t no_response;       // '#' 이후 결과 화면이 나오지 않은 경우
+    uint64_t lcd_violations;    // LCD 타이밍 위반 (busy + 전원 인가 전)
+    uint64_t virtual_ns;
+    uint64_t latency[FLEET_HIST_BUCKETS];
+} fleet_stats_t;
+
+static void stats_merge(fleet_stats_t *dst, const fleet_stats_t *src) {
+    uint64_t *d = (uint64_t *)dst;
+    const uint64_t *s = (const uint64_t *)src;
+    for (size_t i = 0; i < sizeof(*dst) / sizeof(uint64_t); i++) {
+        d[i] += s[i];
+    }
+}
+
+static uint64_t hist_percentile(const uint64_t *hist, double p) {
+    uint64_t total = 0, acc = 0;
+    for (int i = 0; i < FLEET_HIST_BUCKETS; i++) total += hist[i];
+    if (total == 0) return 0;
+    for (int i = 0; i < FLEET_HIST_BUCKETS; i++) {
+        acc += hist[i];
+        if ((double)acc >= p * (double)total) return (uint64_t)i;
+    }
+    return FLEET_HIST_BUCKETS - 1;
+}
+
+// -------------------------------------------------------------------------
+// 2. 유닛 하나의 사용자 행동 모델 (sim_periph_t)
+// -------------------------------------------------------------------------
+
+typedef struct {
+    lockboard_t board;
+    timer0_t timer0;
+    uint64_t rng;
+    uint64_t end_ns;
+
+    char     seq[48];           // 이번 방문에서 누를 키 ('.'은 화면 전환을 기다리는 휴지)
+    uint8_t  seq_len;
+    uint8_t  seq_pos;
+    uint8_t  key_down;          // 다음 이벤트가 키 떼기인지
+    uint64_t next_ns;
+
+    char     password[8];       // 사용자가 알고 있는 현재 비밀번호
+    char     pending[8];        // 변경 중인 새 비밀번호
+    uint8_t  awaiting;          // '#' 이후 결과 화면을 기다리는 중
+    uint64_t hash_ns;           // 마지막 '#'을 뗀 시각
+
+    fleet_stats_t *stats;
+} unit_ctx_t;
+
+static uint32_t rng_next(uint64_t *s) {
+    // xorshift64*
+    *s ^= *s >> 12;
+    *s ^= *s << 25;
+    *s ^= *s >> 27;
+    return (uint32_t)((*s * 2685821657736338717ULL) >> 32);
+}
+
+static uint32_t rng_range(uint64_t *s, uint32_t lo, uint32_t hi) {
+    return lo + rng_next(s) % (hi - lo + 1);
+}
+
+static void random_digits(uint64_t *s, char *out, int n) {
+    for (int i = 0; i < n; i++) out[i] = (char)('0' + rng_range(s, 0, 9));
+    out[n] = '\0';
+}
+
+// 다음 방문의 키 시퀀스를 만듭니다.
+static void plan_visit(unit_ctx_t *c) {
+    uint32_t roll = rng_range(&c->rng, 0, 99);
+    char tmp[8];
+
+    c->seq[0] = '\0';
+    if (roll < 78) {                                    // 정상 출입
+        snprintf(c->seq, sizeof(c->seq), "%s#", c->password);
+    } else if (roll < 88) {                             // 틀린 비밀번호
+        do random_digits(&c->rng, tmp, 7); while (strcmp(tmp, c->password) == 0);
+        snprintf(c->seq, sizeof(c->seq), "%s#", tmp);
+    } else if (roll < 94) {                             // 오타를 '*'로 지우고 다시 입력
+        int at = (int)rng_range(&c->rng, 1, 6);
+        snprintf(c->seq, sizeof(c->seq), "%.*s%c*%s#", at, c->password,
+                 (char)('0' + rng_range(&c->rng, 0, 9)), c->password + at);
+    } else if (roll < 96) {                             // 틀린 관리자 비밀번호
+        do random_digits(&c->rng, tmp, 5); while (strcmp(tmp, ADMIN_PASSWORD) == 0);
+        snprintf(c->seq, sizeof(c->seq), "%s#", tmp);
+    } else if (roll < 98) {                             // 관리자 모드 들어갔다가 취소
+        snprintf(c->seq, sizeof(c->seq), "%s#.*", ADMIN_PASSWORD);
+    } else {                                            // 비밀번호 변경
+        random_digits(&c->rng, c->pending, 7);
+        snprintf(c->seq, sizeof(c->seq), "%s#.#.%s#", ADMIN_PASSWORD, c->pending);
+    }
+    c->seq_len = (uint8_t)strlen(c->seq);
+    c->seq_pos = 0;
+    c->key_down = 0;
+    c->stats->visits++;
+}
+
+static void unit_on_change(lockboard_t *b, sim_unit_t *u, void *user) {
+    unit_ctx_t *c = (unit_ctx_t *)user;
+    char row[HD44780_COLS + 1];
+    uint64_t *counter = 0;
+
+    if (!c->awaiting) {
+        return;
+    }
+    hd44780_row(&b->lcd, 0, row);
+    if (strcmp(row, "OPEN") == 0)               counter = &c->stats->opens;
+    else if (strcmp(row, "Not PassWord") == 0)  counter = &c->stats->denied;
+    else if (strcmp(row, "Not Admin PWD") == 0) counter = &c->stats->admin_denied;
+    else if (strcmp(row, "Admin Mode") == 0)    counter = &c->stats->admin_entries;
+    else if (strcmp(row, "PWD Changed!") == 0) {
+        counter = &c->stats->pwd_changes;
+        memcpy(c->password, c->pending, sizeof(c->password));
+    } else if (strcmp(row, "Enter New PWD") != 0) {
+        return;
+    }
+    if (counter) {
+        (*counter)++;
+    }
+
+    uint64_t ms = (u->now_ns - c->hash_ns) / MS;
+    c->stats->latency[ms < FLEET_HIST_BUCKETS ? ms : FLEET_HIST_BUCKETS - 1]++;
+    c->awaiting = 0;
+}
+
+static uint64_t unit_next(sim_unit_t *u, void *ctx) {
+    (void)u;
+    return ((unit_ctx_t *)ctx)->next_ns;
+}
+
+static void unit_event(sim_unit_t *u, void *ctx) {
+    unit_ctx_t *c = (unit_ctx_t *)ctx;
+
+    if (c->key_down) {                                  // 키 떼기
+        char key = c->seq[c->seq_pos++];
+        lockboard_release(&c->board, u);
+        c->key_down = 0;
+        if (key == '#') {
+            if (c->awaiting) c->stats->no_response++;
+            c->awaiting = 1;
+            c->hash_ns = u->now_ns;
+        }
+        c->next_ns = u->now_ns + rng_range(&c->rng, 100, 250) * MS;
+        if (c->seq_pos < c->seq_len && c->seq[c->seq_pos] == '.') {
+            c->seq_pos++;
+            c->next_ns += 600 * MS;
+        }
+        if (c->seq_pos >= c->seq_len) {
+            // 결과 표시(최대 6초)가 끝난 뒤 다음 방문자까지 평균 90초 정도 쉼
+            c->next_ns = u->now_ns + 8000 * MS + (uint64_t)rng_range(&c->rng, 0, 180000) * MS;
+        }
+        return;
+    }
+
+    if (c->seq_pos >= c->seq_len) {                     // 새 방문 시작
+        if (c->awaiting) {
+            c->stats->no_response++;
+            c->awaiting = 0;
+        }
+        if (u->now_ns >= c->end_ns) {
+            sim_stop(u);
+        }
+        plan_visit(c);
+    }
+    lockboard_press(&c->board, u, c->seq[c->seq_pos]);
+    c->stats->keys++;
+    c->key_down = 1;
+    c->next_ns = u->now_ns + rng_range(&c->rng, 60, 120) * MS;
+}
+
+static const sim_periph_t unit_periph = {
+    "visitor",
+    0,
+    0,
+    unit_next,
+    unit_event
+};
+
+// -------------------------------------------------------------------------
+// 3. 스레드별 펌웨어 인스턴스 (libfw.so 복사본)
+// -------------------------------------------------------------------------
+
+typedef struct {
+    void    *handle;
+    int    (*entry)(void);
+    sim_isr_t vectors[SIM_VECTOR_COUNT];
+    const char *path;
+    int      region_count;
+    uint8_t *region[FLEET_MAX_REGIONS];     // 쓰기 가능 세그먼트 (.data/.bss)
+    size_t   region_len[FLEET_MAX_REGIONS];
+    uint8_t *image[FLEET_MAX_REGIONS];      // 로드 직후의 내용
+    volatile unsigned long *ticks;          // timer_ticks (틱 건너뛰기용, NULL이면 모든 틱을 ISR로 실행)
+    volatile unsigned long *handler_due;    // timer_handler_due
+    volatile unsigned long *wake_due;       // timer_wake_due
+} fw_instance_t;
+
+static int find_regions(struct dl_phdr_info *info, size_t size, void *arg) {
+    fw_instance_t *fw = (fw_instance_t *)arg;
+    (void)size;
+    if (info->dlpi_name == 0 || strcmp(info->dlpi_name, fw->path) != 0) {
+        return 0;
+    }
+    // 재배치 후 읽기 전용이 되는 구간(GOT 등, PT_GNU_RELRO)은 되돌릴 필요도, 쓸 수도 없으므로 제외
+    ElfW(Addr) relro_end = 0;
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr) *ph = &info->dlpi_phdr[i];
+        if (ph->p_type == PT_GNU_RELRO) {
+            relro_end = ph->p_vaddr + ph->p_memsz;
+        }
+    }
+    for (int i = 0; i < info->dlpi_phnum && fw->region_count < FLEET_MAX_REGIONS; i++) {
+        const ElfW(Phdr) *ph = &info->dlpi_phdr[i];
+        ElfW(Addr) start = ph->p_vaddr, end = ph->p_vaddr + ph->p_memsz;
+        if (ph->p_type != PT_LOAD || !(ph->p_flags & PF_W)) {
+            continue;
+        }
+        if (relro_end > start && relro_end < end) {
+            start = relro_end;
+        } else if (relro_end >= end) {
+            continue;
+        }
+        fw->region[fw->region_count] = (uint8_t *)(info->dlpi_addr + start);
+        fw->region_len[fw->region_count] = end - start;
+        fw->region_count++;
+    }
+    return 1;
+}
+
+static int fw_load(fw_instance_t *fw, const void *so, size_t so_len) {
+    char path[] = "/tmp/fleet-fw-XXXXXX.so";
+    int fd = mkstemps(path, 3);
+    char name[16];
+
+    if (fd < 0 || write(fd, so, so_len) != (ssize_t)so_len) {
+        perror("fleet: copy libfw.so");
+        return -1;
+    }
+    close(fd);
+
+    fw->handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (fw->handle == 0) {
+        fprintf(stderr, "fleet: %s\n", dlerror());
+        unlink(path);
+        return -1;
+    }
+    fw->path = path;
+    dl_iterate_phdr(find_regions, fw);
+    fw->path = 0;
+    unlink(path);
+
+    fw->entry = (int (*)(void))dlsym(fw->handle, "firmware_main");
+    for (int v = 1; v < SIM_VECTOR_COUNT; v++) {
+        snprintf(name, sizeof(name), "__vector_%d", v);
+        fw->vectors[v] = (sim_isr_t)dlsym(fw->handle, name);
+    }
+    fw->ticks = (volatile unsigned long *)dlsym(fw->handle, "timer_ticks");
+    fw->handler_due = (volatile unsigned long *)dlsym(fw->handle, "timer_handler_due");
+    fw->wake_due = (volatile unsigned long *)dlsym(fw->handle, "timer_wake_due");
+    if (!fw->handler_due || !fw->wake_due) {
+        fw->ticks = 0;                      // 심볼이 없는 펌웨어는 틱을 건너뛰지 않고 그대로 실행
+    }
+    for (int i = 0; i < fw->region_count; i++) {
+        fw->image[i] = malloc(fw->region_len[i]);
+        memcpy(fw->image[i], fw->region[i], fw->region_len[i]);
+    }
+    return (fw->entry && fw->region_count) ? 0 : -1;
+}
+
+// 펌웨어 RAM을 리셋 직후 상태로 되돌립니다.
+static void fw_reset(fw_instance_t *fw) {
+    for (int i = 0; i < fw->region_count; i++) {
+        memcpy(fw->region[i], fw->image[i], fw->region_len[i]);
+    }
+}
+
+// -------------------------------------------------------------------------
+// 4. 작업 훔치기 스케줄러
+// -------------------------------------------------------------------------
+
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t lo, hi;            // 아직 실행하지 않은 유닛 번호 구간 [lo, hi)
+} range_t;
+
+typedef struct {
+    int       id;
+    pthread_t thread;
+    range_t   range;
+    fw_instance_t fw;
+    fleet_stats_t stats;
+    uint64_t  steals;
+    double    busy_ms;
+} worker_t;
+
+static worker_t *workers;
+static int       worker_count;
+static atomic_uint units_left;
+static uint64_t  unit_seconds = 600;
+static uint64_t  seed = 1;
+
+static int range_pop(range_t *r, uint32_t *unit) {
+    int ok = 0;
+    pthread_mutex_lock(&r->lock);
+    if (r->lo < r->hi) {
+        *unit = r->lo++;
+        ok = 1;
+    }
+    pthread_mutex_unlock(&r->lock);
+    return ok;
+}
+
+// 다른 작업자의 남은 구간 중 뒤쪽 절반을 가져옵니다.
+static int steal(worker_t *self) {
+    for (int k = 1; k < worker_count; k++) {
+        worker_t *victim = &workers[(self->id + k) % worker_count];
+        uint32_t lo = 0, hi = 0;
+
+        pthread_mutex_lock(&victim->range.lock);
+        if (victim->range.hi > victim->range.lo) {
+            uint32_t take = (victim->range.hi - victim->range.lo + 1) / 2;
+            hi = victim->range.hi;
+            lo = hi - take;
+            victim->range.hi = lo;
+        }
+        pthread_mutex_unlock(&victim->range.lock);
+
+        if (hi > lo) {
+            pthread_mutex_lock(&self->range.lock);
+            self->range.lo = lo;
+            self->range.hi = hi;
+            pthread_mutex_unlock(&self->range.lock);
+            self->steals++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void run_unit(worker_t *w, uint32_t id) {
+    sim_unit_t unit;
+    unit_ctx_t ctx;
+
+    fw_reset(&w->fw);
+    sim_unit_init(&unit, FLEET_F_CPU);
+    memcpy(unit.vectors, w->fw.vectors, sizeof(unit.vectors));
+
+    memset(&ctx, 0, sizeof(ctx));
+    lockboard_init(&ctx.board);
+    ctx.board.on_change = unit_on_change;
+    ctx.board.user = &ctx;
+    ctx.stats = &w->stats;
+    ctx.rng = (seed * 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)id * 0xD1B54A32D192ED03ULL) ^ 1;
+    ctx.end_ns = unit_seconds * 1000 * MS;
+    ctx.next_ns = 1000 * MS + rng_range(&ctx.rng, 0, 60000) * MS;
+    ctx.seq_pos = ctx.seq_len = 0;
+    memcpy(ctx.password, INITIAL_PASSWORD, sizeof(ctx.password));
+
+    timer0_init(&ctx.timer0);
+    if (w->fw.ticks) {
+        timer0_fold(&ctx.timer0, w->fw.ticks, w->fw.handler_due, w->fw.wake_due);
+    }
+    sim_attach(&unit, &timer0_periph, &ctx.timer0);
+    sim_attach(&unit, &lockboard_periph, &ctx.board);
+    sim_attach(&unit, &unit_periph, &ctx);
+    sim_run(&unit, w->fw.entry);
+
+    w->stats.units++;
+    w->stats.virtual_ns += unit.now_ns;
+    w->stats.lcd_violations += ctx.board.lcd.busy_violations + ctx.board.lcd.early_writes;
+}
+
+static void *worker_main(void *arg) {
+    worker_t *w = (worker_t *)arg;
+    struct timespec t0, t1;
+    uint32_t id;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t0);
+    while (atomic_load(&units_left) > 0) {
+        if (range_pop(&w->range, &id)) {
+            run_unit(w, id);
+            atomic_fetch_sub(&units_left, 1);
+        } else if (!steal(w)) {
+            sched_yield();
+        }
+    }
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t1);
+    w->busy_ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) / 1e6;
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// 5. main
+// -------------------------------------------------------------------------
+
+static void *read_file(const char *path, size_t *len) {
+    FILE *fp = fopen(path, "rb");
+    void *buf;
+    if (fp == 0) {
+        perror(path);
+        exit(2);
+    }
+    fseek(fp, 0, SEEK_END);
+    *len = (size_t)ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    buf = malloc(*len);
+    if (fread(buf, 1, *len, fp) != *len) {
+        perror(path);
+        exit(2);
+    }
+    fclose(fp);
+    return buf;
+}
+
+int main(int argc, char **argv) {
+    uint32_t units = 1000;
+    const char *so_path = "build/libfw.so";
+    int opt;
+    size_t so_len;
+    struct timespec t0, t1;
+    fleet_stats_t total;
+
+    worker_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    while ((opt = getopt(argc, argv, "n:t:j:s:f:")) != -1) {
+        switch (opt) {
+            case 'n': units = (uint32_t)strtoul(optarg, 0, 10); break;
+            case 't': unit_seconds = strtoull(optarg, 0, 10); break;
+            case 'j': worker_count = atoi(optarg); break;
+            case 's': seed = strtoull(optarg, 0, 10); break;
+            case 'f': so_path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n units] [-t seconds] [-j threads] [-s seed] [-f libfw.so]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (worker_count < 1) worker_count = 1;
+    if (worker_count > FLEET_MAX_THREADS) worker_count = FLEET_MAX_THREADS;
+
+    void *so = read_file(so_path, &so_len);
+    workers = calloc((size_t)worker_count, sizeof(worker_t));
+    for (int i = 0; i < worker_count; i++) {
+        workers[i].id = i;
+        pthread_mutex_init(&workers[i].range.lock, 0);
+        workers[i].range.lo = (uint32_t)((uint64_t)units * i / worker_count);
+        workers[i].range.hi = (uint32_t)((uint64_t)units * (i + 1) / worker_count);
+        if (fw_load(&workers[i].fw, so, so_len) != 0) {
+            return 2;
+        }
+    }
+    free(so);
+    atomic_store(&units_left, units);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < worker_count; i++) {
+        pthread_create(&workers[i].thread, 0, worker_main, &workers[i]);
+    }
+    for (int i = 0; i < worker_count; i++) {
+        pthread_join(workers[i].thread, 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double wall_ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) / 1e6;
+    double busy_ms = 0;
+    uint64_t steals = 0;
+    memset(&total, 0, sizeof(total));
+    for (int i = 0; i < worker_count; i++) {
+        stats_merge(&total, &workers[i].stats);
+        busy_ms += workers[i].busy_ms;
+        steals += workers[i].steals;
+    }
+
+    printf("units          : %llu x %llu s virtual, %d threads\n", (unsigned long long)total.units,
+           (unsigned long long)unit_seconds, worker_count);
+    printf("wall time      : %.1f ms (%.0f units/s, %.0f virtual s per wall s)\n", wall_ms,
+           (double)total.units * 1e3 / wall_ms, (double)total.virtual_ns / 1e6 / wall_ms);
+    printf("parallelism    : %.2f of %d threads busy, %llu steals\n", busy_ms / wall_ms, worker_count,
+           (unsigned long long)steals);
+    printf("visits / keys  : %llu / %llu\n", (unsigned long long)total.visits, (unsigned long long)total.keys);
+    printf("opens          : %llu\n", (unsigned long long)total.opens);
+    printf("failures       : %llu wrong password, %llu wrong admin password, %llu no response\n",
+           (unsigned long long)total.denied, (unsigned long long)total.admin_denied,
+           (unsigned long long)total.no_response);
+    printf("admin entries  : %llu (%llu password changes)\n", (unsigned long long)total.admin_entries,
+           (unsigned long long)total.pwd_changes);
+    printf("lcd violations : %llu\n", (unsigned long long)total.lcd_violations);
+    printf("latency '#'->screen (ms): p50 %llu, p90 %llu, p99 %llu, max %llu%s\n",
+           (unsigned long long)hist_percentile(total.latency, 0.50),
+           (unsigned long long)hist_percentile(total.latency, 0.90),
+           (unsigned long long)hist_percentile(total.latency, 0.99),
+           (unsigned long long)hist_percentile(total.latency, 1.0),
+           total.latency[FLEET_HIST_BUCKETS - 1] ? "+" : "");
+    for (int i = 0; i < FLEET_HIST_BUCKETS; i++) {
+        if (total.latency[i]) {
+            printf("  %3d ms%s %llu\n", i, i == FLEET_HIST_BUCKETS - 1 ? "+" : " ",
+                   (unsigned long long)total.latency[i]);
+        }
+    }
+    return 0;
+}
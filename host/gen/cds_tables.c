@@ -0,0 +1,130 @@
+// =========================================================================
+// 파일명: cds_tables.c
+// 기능: Day11 LED-Segment-CDS 예제의 조도(ADC) → LED 밝기 변환표 생성기
+//       - 펌웨어가 루프마다 하던 계산(ADC 역비례 밝기, LED별 비율, 6단계 최근접 양자화)을
+//         여기서 모든 입력에 대해 미리 해 두고, 감마 보정까지 적용한 결과를 PROGMEM 표로 출력합니다.
+//       - 펌웨어의 Set_LED_Brightness()는 ADC 1회 + LED마다 1회의 표 조회만 하면 됩니다.
+//
+// 사용법: cds_tables [-d 어두움ADC] [-g 감마] > cds_tables.h   (make tables)
+// =========================================================================
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define ADC_COUNT       1024    // 10비트 ADC
+#define LED_COUNT       8       // PORTE LED 수
+#define LEVEL_COUNT     6       // 밝기 단계 (0%, 20%, 40%, 60%, 80%, 100%)
+
+static unsigned int adc_dark = 700;     // 이 값 이상이면 전체 밝기 0 (밝은 환경)
+static double gamma_exp = 2.2;          // 1.0이면 감마 보정 없음 (예전 선형 단계 그대로)
+
+// 예전 펌웨어와 같은 계산: ADC → 전체 밝기 (0 ~ 255, 어두울수록 밝음)
+static unsigned char overall_brightness(unsigned int adc) {
+    if (adc > adc_dark) {
+        adc = adc_dark;
+    }
+    return (unsigned char)((adc_dark - adc) * 255UL / adc_dark);
+}
+
+// 예전 펌웨어와 같은 계산: 전체 밝기 → LED i의 6단계 밝기 (가장 가까운 단계, 같으면 낮은 쪽)
+static unsigned char quantized_level(int led, unsigned char overall) {
+    static const unsigned char levels[LEVEL_COUNT] = { 0, 51, 102, 153, 204, 255 };
+    unsigned int raw = ((led + 1) * overall) / LED_COUNT;
+    unsigned char best = 0;
+    unsigned char min_diff = 255;
+
+    for (int lvl = 0; lvl < LEVEL_COUNT; lvl++) {
+        unsigned char diff = (raw > levels[lvl]) ? (raw - levels[lvl]) : (levels[lvl] - raw);
+        if (diff < min_diff) {
+            min_diff = diff;
+            best = levels[lvl];
+        }
+    }
+    return best;
+}
+
+// 밝기 단계 → BAM 듀티 (감마 보정, 0과 255는 그대로)
+static unsigned char gamma_duty(unsigned char level) {
+    return (unsigned char)lround(255.0 * pow(level / 255.0, gamma_exp));
+}
+
+static void print_table(const unsigned char *v, int n, const char *indent) {
+    for (int i = 0; i < n; i++) {
+        printf("%s%s%3u%s", (i % 16) ? "" : indent, (i % 16) ? " " : "",
+               v[i], (i + 1 < n) ? "," : "");
+        if (i % 16 == 15 || i + 1 == n) {
+            printf("\r\n");
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    static unsigned char brightness[ADC_COUNT];
+    static unsigned char led_level[LED_COUNT][256];
+    unsigned char duty[LEVEL_COUNT];
+    int opt;
+
+    while ((opt = getopt(argc, argv, "d:g:")) != -1) {
+        switch (opt) {
+        case 'd': adc_dark = (unsigned int)strtoul(optarg, NULL, 0); break;
+        case 'g': gamma_exp = strtod(optarg, NULL); break;
+        default:
+            fprintf(stderr, "usage: %s [-d dark_adc] [-g gamma] > cds_tables.h\n", argv[0]);
+            return 2;
+        }
+    }
+    if (adc_dark == 0 || adc_dark >= ADC_COUNT || gamma_exp <= 0.0) {
+        fprintf(stderr, "cds_tables: dark_adc must be 1..%d and gamma > 0\n", ADC_COUNT - 1);
+        return 2;
+    }
+
+    for (unsigned int adc = 0; adc < ADC_COUNT; adc++) {
+        brightness[adc] = overall_brightness(adc);
+    }
+    for (int led = 0; led < LED_COUNT; led++) {
+        for (int b = 0; b < 256; b++) {
+            led_level[led][b] = gamma_duty(quantized_level(led, (unsigned char)b));
+        }
+    }
+    for (int lvl = 0; lvl < LEVEL_COUNT; lvl++) {
+        duty[lvl] = gamma_duty((unsigned char)(lvl * 51));
+    }
+
+    printf("// =========================================================================\r\n");
+    printf("// 파일명: cds_tables.h (자동 생성 파일 - 직접 수정하지 말고 다시 생성하세요)\r\n");
+    printf("// 생성: make -C host tables  (host/gen/cds_tables.c -d %u -g %.2f)\r\n", adc_dark, gamma_exp);
+    printf("// 기능: 조도(ADC) → LED 밝기 변환표\r\n");
+    printf("//   - cds_brightness[adc]    : ADC 값 → 전체 밝기 (0 ~ 255, 어두울수록 밝음, %u 이상은 0)\r\n", adc_dark);
+    printf("//   - cds_led_level[i][b]    : 전체 밝기 b일 때 LED i의 BAM 듀티\r\n");
+    printf("//                              (b * (i + 1) / 8을 6단계로 양자화한 뒤 감마 보정)\r\n");
+    printf("//   - 6단계 듀티: ");
+    for (int lvl = 0; lvl < LEVEL_COUNT; lvl++) {
+        printf("%u%s", duty[lvl], (lvl + 1 < LEVEL_COUNT) ? ", " : "\r\n");
+    }
+    printf("// =========================================================================\r\n");
+    printf("\r\n");
+    printf("#ifndef CDS_TABLES_H_\r\n");
+    printf("#define CDS_TABLES_H_\r\n");
+    printf("\r\n");
+    printf("#include <avr/pgmspace.h>\r\n");
+    printf("\r\n");
+    printf("#define CDS_ADC_DARK    %u\r\n", adc_dark);
+    printf("#define CDS_LED_COUNT   %d\r\n", LED_COUNT);
+    printf("\r\n");
+    printf("static const unsigned char cds_brightness[%d] PROGMEM = {\r\n", ADC_COUNT);
+    print_table(brightness, ADC_COUNT, "\t");
+    printf("};\r\n");
+    printf("\r\n");
+    printf("static const unsigned char cds_led_level[CDS_LED_COUNT][256] PROGMEM = {\r\n");
+    for (int led = 0; led < LED_COUNT; led++) {
+        printf("\t{ // LED %d\r\n", led);
+        print_table(led_level[led], 256, "\t\t");
+        printf("\t}%s\r\n", (led + 1 < LED_COUNT) ? "," : "");
+    }
+    printf("};\r\n");
+    printf("\r\n");
+    printf("#endif /* CDS_TABLES_H_ */\r\n");
+    return 0;
+}
@@ -0,0 +1,61 @@
+// =========================================================================
+// 파일명: gamma16.c
+// 기능: 16비트 PWM 감마 보정표 생성기
+//       - 밝기 단계(0 ~ 255) → 16비트 듀티(65535 * (i / 255)^감마)를 PROGMEM 표로 출력합니다.
+//       - Project1.4의 LED 드라이버(led.c)와 Common/rgbfade가 같은 표를 쓰므로, 두 곳의 gamma16.h를 모두 이 파일로 만듭니다.
+//         (펌웨어는 PWM 해상도에 맞게 오른쪽으로 시프트해서 씀)
+//
+// 사용법: gamma16 [-g 감마] > gamma16.h   (make tables)
+// =========================================================================
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define LEVEL_COUNT     256
+
+static double gamma_exp = 2.2;          // 사람 눈은 밝기를 로그에 가깝게 느끼므로 2.2 (1.0이면 선형)
+
+int main(int argc, char **argv) {
+    int opt;
+
+    while ((opt = getopt(argc, argv, "g:")) != -1) {
+        switch (opt) {
+        case 'g': gamma_exp = strtod(optarg, NULL); break;
+        default:
+            fprintf(stderr, "usage: %s [-g gamma] > gamma16.h\n", argv[0]);
+            return 2;
+        }
+    }
+    if (gamma_exp <= 0.0) {
+        fprintf(stderr, "gamma16: gamma must be > 0\n");
+        return 2;
+    }
+
+    printf("// =========================================================================\r\n");
+    printf("// 파일명: gamma16.h (자동 생성 파일 - 직접 수정하지 말고 다시 생성하세요)\r\n");
+    printf("// 생성: make -C host tables  (host/gen/gamma16.c -g %.2f)\r\n", gamma_exp);
+    printf("// 기능: 감마 보정표 (8비트 밝기 → 16비트 듀티, 65535 * (i / 255)^%.2f)\r\n", gamma_exp);
+    printf("//   - 사람 눈은 밝기를 로그에 가깝게 느끼므로, 듀티를 그대로 쓰면 어두운 쪽 단계가 뭉개집니다.\r\n");
+    printf("//   - PWM 해상도가 16비트보다 작으면 오른쪽으로 시프트해서 씁니다.\r\n");
+    printf("// =========================================================================\r\n");
+    printf("\r\n");
+    printf("#ifndef GAMMA16_H_\r\n");
+    printf("#define GAMMA16_H_\r\n");
+    printf("\r\n");
+    printf("#include <avr/pgmspace.h>\r\n");
+    printf("\r\n");
+    printf("static const uint16_t gamma16[%d] PROGMEM = {\r\n", LEVEL_COUNT);
+    for (int i = 0; i < LEVEL_COUNT; i++) {
+        long duty = lround(65535.0 * pow(i / (double)(LEVEL_COUNT - 1), gamma_exp));
+        printf("%s%5ld%s", (i % 8) ? " " : "\t", duty, (i + 1 < LEVEL_COUNT) ? "," : "");
+        if (i % 8 == 7) {
+            printf("\r\n");
+        }
+    }
+    printf("};\r\n");
+    printf("\r\n");
+    printf("#endif /* GAMMA16_H_ */\r\n");
+    return 0;
+}
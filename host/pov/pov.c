@@ -0,0 +1,308 @@
+// =========================================================================
+// 파일명: pov.c
+// 기능: FND 다중화 방식 비교 벤치마크 (가상 ATmega128 + FND 잔상 모델)
+//       - 펌웨어가 세그먼트/자리 선택 포트에 쓰는 값을 가상 시각과 함께 관찰해,
+//         자리별 갱신 빈도, 켜진 비율, 최장 꺼짐 구간, 잔상(ghosting)을 측정합니다.
+//       - 마지막 -w ms 동안 세그먼트별로 켜진 시간을 눈에 보이는 모습(ASCII)으로 그립니다.
+//         ('#' 가장 밝은 세그먼트의 50% 이상, '+' 10% 이상, '.' 0.5% 이상)
+//       - 보드에서 Segment() 루프 횟수를 눈으로 맞추던 일을 PC에서 수치로 비교하기 위한 도구입니다.
+//
+// 사용법: pov [-m loop|isr|timer5] [-r 갱신Hz] [-l 밝기] [-n 표시값] [-t ms] [-s ms] [-w ms]
+//       -m loop   : 예제들이 쓰던 LSegment()/RSegment() 루프 (자리마다 _delay_ms(1), 아래에 그대로 옮겨 둠)
+//                   -n 값의 앞 두 자리와 뒤 두 자리를 표시
+//       -m isr    : Common/fnd 드라이버 (Timer3 CTC 인터럽트). 하네스가 main 역할을 하며
+//                   fnd_init(-r) → fnd_set_brightness(-l) → fnd_show(-n) 후 메인 루프는 다른 일만 함
+//       -m timer5 : Day9/Timer5를 수정 없이 실행 (fndlayout 뷰 2개를 fnd 인터럽트가 그림)
+//       모든 방식은 Day9 예제와 같은 14.7456MHz(F_CPU)로 실행합니다.
+//       -t      : 측정 시간 (기본 1000ms), -s : 측정 전 건너뛸 초기화 시간 (기본 100ms)
+//       -w      : 그림에 쓸 마지막 구간 (기본 40ms, 눈이 빛을 모으는 시간 정도)
+// =========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <util/delay.h>
+#include "sim.h"
+#include "timer0.h"
+#include "timer16.h"
+#include "fndview.h"
+#include "fnd/fnd.h"
+
+#define MS                  1000000ULL  // 1ms (ns 단위)
+
+// -Dmain=firmware_main 으로 정적 링크된 Day9/Timer5
+int firmware_main(void);
+
+static unsigned int  pov_value = 1234;
+static unsigned int  pov_hz = FND_REFRESH_HZ;
+static unsigned char pov_level = 255;
+
+// Day9/Timer5, Timer6가 fndlayout으로 바뀌기 전의 표시 코드 (비교 기준, 폰트 표의 잘못된 6도 그대로)
+static const unsigned char pov_font[18] = {
+    0x3F, 0x06, 0x5B, 0x4F,
+    0x66, 0x6D, 0x7C, 0x07,
+    0x7F, 0x67, 0x77, 0x7C,
+    0x39, 0x5E, 0x79, 0x71,
+    0x08, 0x80
+};
+
+static void pov_rsegment(int n) {
+    unsigned char n10 = n / 10;
+    unsigned char n1 = n % 10;
+
+    for (int i = 0; i < 5; i++) {
+        PORTC = 0x0B;
+        PORTA = pov_font[n10];
+        _delay_ms(1);
+
+        PORTC = 0x07;
+        PORTA = pov_font[n1];
+        _delay_ms(1);
+    }
+}
+
+static void pov_lsegment(int n) {
+    unsigned char n10 = n / 10;
+    unsigned char n1 = n % 10;
+
+    for (int i = 0; i < 5; i++) {
+        PORTC = 0x0E;
+        PORTA = pov_font[n10];
+        _delay_ms(1);
+
+        PORTC = 0x0D;
+        PORTA = pov_font[n1];
+        _delay_ms(1);
+    }
+}
+
+// loop 방식의 main
+static int pov_loop_main(void) {
+    DDRA = 0xFF;
+    DDRC = 0x0F;
+    PORTA = 0xFF;
+    PORTC = 0x0F;
+    for (;;) {
+        pov_lsegment(pov_value / 100 % 100);
+        pov_rsegment(pov_value % 100);
+    }
+    return 0;
+}
+
+// isr 방식의 main: 표시 내용만 정하고 나머지는 드라이버 인터럽트에 맡김
+static int pov_isr_main(void) {
+    fnd_init(pov_hz);
+    fnd_set_brightness(pov_level);
+    fnd_show(pov_value);
+    sei();
+    for (;;) {
+        _delay_ms(1);
+    }
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// 1. 측정 구간 관리: 초기화 구간이 끝나면 기록을 새로 시작하고, 그림 구간 시작에서 스냅숏, 끝에서 정지
+// -------------------------------------------------------------------------
+
+typedef struct {
+    fndview_t *view;
+    fndview_t  snap;            // 그림 구간 시작 시점의 기록
+    uint64_t   at[3];           // 0: 측정 시작, 1: 그림 구간 시작, 2: 종료
+    uint8_t    step;
+} pov_t;
+
+static uint64_t pov_next(sim_unit_t *u, void *ctx) {
+    const pov_t *p = (const pov_t *)ctx;
+    (void)u;
+    return p->step < 3 ? p->at[p->step] : SIM_NEVER;
+}
+
+static void pov_event(sim_unit_t *u, void *ctx) {
+    pov_t *p = (pov_t *)ctx;
+
+    switch (p->step++) {
+        case 0:
+            fndview_reset(p->view, u->now_ns);
+            break;
+        case 1:
+            fndview_sync(p->view, u->now_ns);
+            p->snap = *p->view;
+            break;
+        default:
+            fndview_sync(p->view, u->now_ns);
+            sim_stop(u);
+            break;
+    }
+}
+
+static const sim_periph_t pov_periph = {
+    "pov",
+    0,
+    0,
+    pov_next,
+    pov_event
+};
+
+// -------------------------------------------------------------------------
+// 2. 출력
+// -------------------------------------------------------------------------
+
+// 자리 하나를 5줄로 그릴 때 각 칸에 오는 세그먼트 (-1 = 빈칸, 6칸 = 자리 5칸 + dp)
+static const signed char pov_art[5][6] = {
+    { -1,  0,  0,  0, -1, -1 },
+    {  5, -1, -1, -1,  1, -1 },
+    { -1,  6,  6,  6, -1, -1 },
+    {  4, -1, -1, -1,  2, -1 },
+    { -1,  3,  3,  3, -1,  7 },
+};
+
+static void pov_draw(const fndview_t *v, const fndview_t *snap) {
+    uint64_t lit[FNDVIEW_MAX_DIGITS][8];
+    uint64_t max = 0;
+
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        for (uint8_t b = 0; b < 8; b++) {
+            lit[i][b] = v->d[i].seg_ns[b] - snap->d[i].seg_ns[b];
+            if (lit[i][b] > max) {
+                max = lit[i][b];
+            }
+        }
+    }
+    for (uint8_t row = 0; row < 5; row++) {
+        printf("  ");
+        for (uint8_t i = 0; i < v->cfg.digits; i++) {
+            for (uint8_t col = 0; col < 6; col++) {
+                signed char b = pov_art[row][col];
+                double r = (b < 0 || max == 0) ? 0.0 : (double)lit[i][(uint8_t)b] / (double)max;
+                putchar(r >= 0.5 ? '#' : r >= 0.1 ? '+' : r >= 0.005 ? '.' : ' ');
+            }
+            printf("  ");
+        }
+        printf("\n");
+    }
+}
+
+static void pov_report(const sim_unit_t *u, const pov_t *p, const char *mode) {
+    const fndview_t *v = p->view;
+    double span = (double)(p->at[2] - p->at[0]);
+    double slowest = 0;
+    uint64_t worst_gap = 0;
+
+    printf("mode           : %s, %.4f MHz\n", mode, u->f_cpu / 1e6);
+    printf("window         : %.0f ms after %.0f ms settle, %u port writes, %llu ISRs\n", span / MS,
+           (double)p->at[0] / MS, v->writes, (unsigned long long)u->isr_calls);
+    printf("digit          :");
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        double hz = v->d[i].windows * 1e9 / span;
+        if (i == 0 || hz < slowest) {
+            slowest = hz;
+        }
+        if (v->d[i].worst_gap_ns > worst_gap) {
+            worst_gap = v->d[i].worst_gap_ns;
+        }
+        printf(" %9u", i + 1);
+    }
+    printf("\n  refresh (Hz) :");
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        printf(" %9.1f", v->d[i].windows * 1e9 / span);
+    }
+    printf("\n  duty (%%)     :");
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        printf(" %9.2f", v->d[i].on_ns * 100.0 / span);
+    }
+    printf("\n  worst gap(ms):");
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        printf(" %9.3f", (double)v->d[i].worst_gap_ns / MS);
+    }
+    printf("\n  ghost (%%)    :");
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        printf(" %9.4f", v->d[i].on_ns ? v->d[i].ghost_ns * 100.0 / v->d[i].on_ns : 0.0);
+    }
+    printf("\n  ghost writes :");
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        printf(" %9u", v->d[i].ghost_writes);
+    }
+    // 자리가 자주 켜져도 몇 번 몰아서 켠 뒤 오래 쉬면 눈에는 긴 꺼짐 구간 주기로 깜빡여 보임
+    printf("\nrefresh        : %.1f Hz windows (slowest digit), %.1f Hz from the worst gap%s\n", slowest,
+           worst_gap ? 1e9 / worst_gap : 0.0, worst_gap * FND_REFRESH_MIN > 1000000000ULL ? "  <- visible flicker" : "");
+    printf("overlap        : %.3f ms with two or more digits selected\n", (double)v->overlap_ns / MS);
+    printf("all dark       : %.2f%% of the window, worst %.3f ms\n", v->dark_ns * 100.0 / span,
+           (double)v->worst_dark_ns / MS);
+    printf("view (last %.0f ms):\n", (double)(p->at[2] - p->at[1]) / MS);
+    pov_draw(v, &p->snap);
+}
+
+// -------------------------------------------------------------------------
+// 3. main
+// -------------------------------------------------------------------------
+
+int main(int argc, char **argv) {
+    static sim_unit_t unit;
+    static timer0_t timer0;
+    static timer16_t timer1, timer3;
+    static fndview_t view;
+    static pov_t pov;
+    const char *mode = "loop";
+    uint64_t total_ms = 1000, settle_ms = 100, view_ms = 40;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "m:r:l:n:t:s:w:")) != -1) {
+        switch (opt) {
+            case 'm': mode = optarg; break;
+            case 'r': pov_hz = (unsigned int)atoi(optarg); break;
+            case 'l': pov_level = (unsigned char)atoi(optarg); break;
+            case 'n': pov_value = (unsigned int)atoi(optarg); break;
+            case 't': total_ms = strtoull(optarg, 0, 10); break;
+            case 's': settle_ms = strtoull(optarg, 0, 10); break;
+            case 'w': view_ms = strtoull(optarg, 0, 10); break;
+            default:
+                mode = "";
+                break;
+        }
+    }
+    if ((strcmp(mode, "loop") != 0 && strcmp(mode, "isr") != 0 && strcmp(mode, "timer5") != 0) || total_ms == 0) {
+        fprintf(stderr, "usage: %s [-m loop|isr|timer5] [-r refresh-hz] [-l level] [-n value] [-t ms] [-s settle-ms] [-w view-ms]\n",
+                argv[0]);
+        return 2;
+    }
+    if (view_ms > total_ms) {
+        view_ms = total_ms;
+    }
+
+    sim_unit_init(&unit, F_CPU);
+    sim_bind_vectors(&unit);
+    fndview_init(&view, &fndview_porta_c);
+    pov.view = &view;
+    pov.at[0] = settle_ms * MS;
+    pov.at[2] = (settle_ms + total_ms) * MS;
+    pov.at[1] = pov.at[2] - view_ms * MS;
+
+    sim_attach(&unit, &fndview_periph, &view);
+    timer0_init(&timer0);
+    sim_attach(&unit, &timer0_periph, &timer0);
+    timer16_init(&timer1, &timer16_t1);
+    sim_attach(&unit, &timer16_periph, &timer1);
+    timer16_init(&timer3, &timer16_t3);
+    sim_attach(&unit, &timer16_periph, &timer3);
+    sim_attach(&unit, &pov_periph, &pov);
+
+    if (sim_run(&unit, strcmp(mode, "loop") == 0 ? pov_loop_main :
+                       strcmp(mode, "isr") == 0 ? pov_isr_main : firmware_main)) {
+        fprintf(stderr, "pov: firmware main() returned\n");
+        return 1;
+    }
+    if (strcmp(mode, "loop") == 0) {
+        pov_report(&unit, &pov, "loop (LSegment/RSegment, _delay_ms(1) per digit)");
+    } else if (strcmp(mode, "timer5") == 0) {
+        pov_report(&unit, &pov, "timer5 (Day9/Timer5, fndlayout views on Common/fnd)");
+    } else {
+        char label[64];
+        snprintf(label, sizeof(label), "isr (Common/fnd, %u Hz, level %u, value %u)", fnd_refresh_hz(), pov_level,
+                 pov_value);
+        pov_report(&unit, &pov, label);
+    }
+    return 0;
+}
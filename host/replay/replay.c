@@ -0,0 +1,516 @@
+// =========================================================================
+// 파일명: replay.c
+// 기능: Project1.4 펌웨어(main.c, lcd.c, keypad.c, led.c)를 수정 없이 가상 시간으로 실행하는
+//       재생 하네스입니다.
+//       - 시나리오 스크립트의 키 입력을 가상 키패드에 넣고,
+//         LCD 두 줄과 LED 색상의 변화를 가상 밀리초 단위로 기록합니다.
+//       - expect / within 으로 동작과 응답 시간 예산을 검사하고, 실패 시 종료 코드 1을 돌려줍니다.
+//
+// 사용법: replay [-q] [-x] <script>
+//       -q : 변화 로그를 출력하지 않음 (요약과 검사 결과만)
+//       -x : 유휴 폴링 건너뛰기를 끔 (모든 폴링과 1ms 틱 ISR을 가상 시간대로 실행)
+//
+// 스크립트 문법 (한 줄에 하나, '#' 이후는 주석. 단 따옴표 안의 '#'은 문자):
+//   hold <ms>                    키를 누르고 있는 시간 (기본 80ms)
+//   gap <ms>                     키를 뗀 뒤 다음 키까지의 간격 (기본 150ms)
+//   keys <문자열>                 문자열의 각 키를 차례로 입력 ('#'도 키로 취급)
+//   wait <ms>                    가상 시간 진행
+//   expect lcd <0|1> "<text>"    지금 해당 줄의 내용이 text와 같아야 함 (끝 공백 무시)
+//   expect led <색상>            지금 LED 색상이 같아야 함 (OFF/RED/GREEN/YELLOW/...)
+//   within <ms> lcd <0|1> "<text>"  마지막 키를 뗀 시각부터 ms 안에 조건이 만족되어야 함
+//   within <ms> led <색상>
+//   end                          시나리오 종료 (생략 시 마지막 항목 시각에 종료)
+// =========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "timer0.h"
+#include "lockboard.h"
+#include "power/power.h"     // 펌웨어의 슬립 체류 통계 (power_stats)
+#include "boot/boot.h"       // 펌웨어의 부팅 단계 타임스탬프 (boot_trace)
+#include "timer/timer.h"     // 펌웨어의 틱 카운터 (timer_ticks, timer_handler_due, timer_wake_due)
+
+#define REPLAY_F_CPU        14745600UL  // main.c의 F_CPU와 동일
+#define REPLAY_MAX_ITEMS    16384
+#define REPLAY_MAX_WATCHES  16
+#define MS                  1000000ULL  // 1ms (ns 단위)
+#define REPLAY_PROMPT       "Input PassWord"    // 부팅 완료로 보는 첫 안내 문구
+
+int firmware_main(void);    // -Dmain=firmware_main 으로 컴파일된 펌웨어 main()
+
+typedef enum {
+    ITEM_KEY_DOWN,
+    ITEM_KEY_UP,
+    ITEM_EXPECT,
+    ITEM_WITHIN,
+    ITEM_END
+} item_kind_t;
+
+typedef enum {
+    COND_LCD,
+    COND_LED
+} cond_kind_t;
+
+typedef struct {
+    cond_kind_t kind;
+    int  row;                           // COND_LCD: 행 번호
+    int  led;                           // COND_LED: 색상
+    char text[HD44780_COLS + 1];        // COND_LCD: 기대 문자열
+} cond_t;
+
+typedef struct {
+    uint64_t    t_ns;
+    item_kind_t kind;
+    char        key;
+    cond_t      cond;
+    uint64_t    budget_ns;              // ITEM_WITHIN: 허용 시간
+    int         line;                   // 스크립트 줄 번호 (오류 보고용)
+} item_t;
+
+typedef struct {
+    const item_t *item;
+    uint64_t start_ns;
+    uint64_t deadline_ns;
+} watch_t;
+
+typedef struct {
+    item_t   items[REPLAY_MAX_ITEMS];
+    int      count;
+    int      pos;
+    watch_t  watches[REPLAY_MAX_WATCHES];
+    int      watch_count;
+
+    lockboard_t board;
+    int      quiet;
+    int      checks;
+    int      failures;
+
+    // 밀리초 단위 변화 로그 (같은 ms 안의 변화는 마지막 상태 하나로 합침)
+    int      pending;
+    uint64_t pending_ms;
+    char     pending_row[2][HD44780_COLS + 1];
+    uint8_t  pending_led;
+
+    uint64_t prompt_ns;                 // 리셋 후 LCD 1행에 REPLAY_PROMPT가 처음 보인 시각 (0 = 아직)
+} replay_t;
+
+static replay_t replay;
+
+// -------------------------------------------------------------------------
+// 1. 조건 검사
+// -------------------------------------------------------------------------
+
+static int cond_holds(const lockboard_t *b, const cond_t *c) {
+    if (c->kind == COND_LED) {
+        return b->led == c->led;
+    }
+    char row[HD44780_COLS + 1];
+    hd44780_row(&b->lcd, c->row, row);
+    return strcmp(row, c->text) == 0;
+}
+
+static void cond_describe(const cond_t *c, char *out, size_t len) {
+    if (c->kind == COND_LED) {
+        snprintf(out, len, "led %s", lockboard_led_name((uint8_t)c->led));
+    } else {
+        snprintf(out, len, "lcd %d \"%s\"", c->row, c->text);
+    }
+}
+
+static void report_actual(const lockboard_t *b, const cond_t *c) {
+    if (c->kind == COND_LED) {
+        printf("        actual: led %s\n", lockboard_led_name(b->led));
+    } else {
+        char row[HD44780_COLS + 1];
+        hd44780_row(&b->lcd, c->row, row);
+        printf("        actual: lcd %d \"%s\"\n", c->row, row);
+    }
+}
+
+// 감시 중인 within 조건을 확인하고, 만족된 항목은 목록에서 제거합니다.
+static void watches_poll(replay_t *r, uint64_t now_ns) {
+    for (int i = 0; i < r->watch_count; ) {
+        watch_t *w = &r->watches[i];
+        char desc[64];
+        cond_describe(&w->item->cond, desc, sizeof(desc));
+
+        if (cond_holds(&r->board, &w->item->cond)) {
+            printf("  budget  line %-4d %-28s %9.3f ms (limit %llu ms)\n", w->item->line, desc,
+                   (double)(now_ns - w->start_ns) / MS, (unsigned long long)(w->item->budget_ns / MS));
+        } else if (now_ns >= w->deadline_ns) {
+            printf("  FAIL    line %-4d %-28s not reached within %llu ms\n", w->item->line, desc,
+                   (unsigned long long)(w->item->budget_ns / MS));
+            report_actual(&r->board, &w->item->cond);
+            r->failures++;
+        } else {
+            i++;
+            continue;
+        }
+        r->watches[i] = r->watches[--r->watch_count];
+    }
+}
+
+// -------------------------------------------------------------------------
+// 2. 변화 로그
+// -------------------------------------------------------------------------
+
+static void trace_flush(replay_t *r) {
+    if (!r->pending) {
+        return;
+    }
+    printf("[%8llu ms] %-16s | %-16s | LED %s\n", (unsigned long long)r->pending_ms,
+           r->pending_row[0], r->pending_row[1], lockboard_led_name(r->pending_led));
+    r->pending = 0;
+}
+
+static void on_board_change(lockboard_t *b, sim_unit_t *u, void *user) {
+    replay_t *r = (replay_t *)user;
+    uint64_t ms = u->now_ns / MS;
+
+    if (r->prompt_ns == 0) {
+        char row[HD44780_COLS + 1];
+        hd44780_row(&b->lcd, 0, row);
+        if (strcmp(row, REPLAY_PROMPT) == 0) {
+            r->prompt_ns = u->now_ns;
+        }
+    }
+
+    if (!r->quiet) {
+        if (r->pending && r->pending_ms != ms) {
+            trace_flush(r);
+        }
+        r->pending = 1;
+        r->pending_ms = ms;
+        hd44780_row(&b->lcd, 0, r->pending_row[0]);
+        hd44780_row(&b->lcd, 1, r->pending_row[1]);
+        r->pending_led = b->led;
+    }
+    watches_poll(r, u->now_ns);
+}
+
+// -------------------------------------------------------------------------
+// 3. 타임라인 구동 (sim_periph_t)
+// -------------------------------------------------------------------------
+
+static uint64_t agenda_next(sim_unit_t *u, void *ctx) {
+    replay_t *r = (replay_t *)ctx;
+    uint64_t next = SIM_NEVER;
+    (void)u;
+
+    if (r->pos < r->count) {
+        next = r->items[r->pos].t_ns;
+    }
+    for (int i = 0; i < r->watch_count; i++) {
+        if (r->watches[i].deadline_ns < next) {
+            next = r->watches[i].deadline_ns;
+        }
+    }
+    return next;
+}
+
+static void agenda_event(sim_unit_t *u, void *ctx) {
+    replay_t *r = (replay_t *)ctx;
+
+    while (r->pos < r->count && r->items[r->pos].t_ns <= u->now_ns) {
+        const item_t *it = &r->items[r->pos++];
+        switch (it->kind) {
+            case ITEM_KEY_DOWN:
+                lockboard_press(&r->board, u, it->key);
+                break;
+            case ITEM_KEY_UP:
+                lockboard_release(&r->board, u);
+                break;
+            case ITEM_EXPECT: {
+                char desc[64];
+                cond_describe(&it->cond, desc, sizeof(desc));
+                r->checks++;
+                if (!cond_holds(&r->board, &it->cond)) {
+                    printf("  FAIL    line %-4d %-28s at %llu ms\n", it->line, desc,
+                           (unsigned long long)(u->now_ns / MS));
+                    report_actual(&r->board, &it->cond);
+                    r->failures++;
+                }
+                break;
+            }
+            case ITEM_WITHIN:
+                r->checks++;
+                if (r->watch_count < REPLAY_MAX_WATCHES) {
+                    watch_t *w = &r->watches[r->watch_count++];
+                    w->item = it;
+                    w->start_ns = it->t_ns;
+                    w->deadline_ns = it->t_ns + it->budget_ns;
+                }
+                break;
+            case ITEM_END:
+                watches_poll(r, u->now_ns);
+                for (int i = 0; i < r->watch_count; i++) {
+                    printf("  FAIL    line %-4d unresolved at end of script\n", r->watches[i].item->line);
+                    r->failures++;
+                }
+                r->watch_count = 0;
+                sim_stop(u);
+                break;
+        }
+    }
+    watches_poll(r, u->now_ns);
+}
+
+static const sim_periph_t agenda_periph = {
+    "agenda",
+    0,
+    0,
+    agenda_next,
+    agenda_event
+};
+
+// -------------------------------------------------------------------------
+// 4. 스크립트 해석
+// -------------------------------------------------------------------------
+
+static item_t *add_item(replay_t *r, uint64_t t_ns, item_kind_t kind, int line) {
+    if (r->count >= REPLAY_MAX_ITEMS) {
+        fprintf(stderr, "line %d: too many script items\n", line);
+        exit(2);
+    }
+    item_t *it = &r->items[r->count++];
+    memset(it, 0, sizeof(*it));
+    it->t_ns = t_ns;
+    it->kind = kind;
+    it->line = line;
+    return it;
+}
+
+// "lcd <row> \"text\"" 또는 "led <color>" 를 해석합니다.
+static int parse_cond(const char *s, cond_t *c) {
+    char what[8];
+    int n = 0;
+
+    if (sscanf(s, "%7s %n", what, &n) != 1) {
+        return -1;
+    }
+    s += n;
+    if (strcmp(what, "led") == 0) {
+        char color[16];
+        if (sscanf(s, "%15s", color) != 1) {
+            return -1;
+        }
+        c->kind = COND_LED;
+        c->led = lockboard_led_parse(color);
+        return c->led < 0 ? -1 : 0;
+    }
+    if (strcmp(what, "lcd") == 0) {
+        if (sscanf(s, "%d %n", &c->row, &n) != 1 || (c->row != 0 && c->row != 1)) {
+            return -1;
+        }
+        s += n;
+        const char *q2 = (*s == '"') ? strrchr(s + 1, '"') : 0;
+        if (q2 == 0 || q2 - s - 1 > HD44780_COLS) {
+            return -1;
+        }
+        c->kind = COND_LCD;
+        memcpy(c->text, s + 1, (size_t)(q2 - s - 1));
+        c->text[q2 - s - 1] = '\0';
+        for (int len = (int)strlen(c->text); len > 0 && c->text[len - 1] == ' '; len--) {
+            c->text[len - 1] = '\0';
+        }
+        return 0;
+    }
+    return -1;
+}
+
+// 따옴표 밖의 '#' 주석과 줄 끝 공백을 제거합니다. (keys 명령의 '#'은 키로 남겨둠)
+static void strip_comment(char *line) {
+    int quoted = 0;
+    int is_keys = strncmp(line, "keys", 4) == 0;
+    for (char *p = line; *p; p++) {
+        if (*p == '"') {
+            quoted = !quoted;
+        } else if (*p == '#' && !quoted && !is_keys) {
+            *p = '\0';
+            break;
+        }
+    }
+    for (int len = (int)strlen(line); len > 0 && strchr(" \t\r\n", line[len - 1]); len--) {
+        line[len - 1] = '\0';
+    }
+}
+
+static int cmp_items(const void *a, const void *b) {
+    const item_t *x = (const item_t *)a;
+    const item_t *y = (const item_t *)b;
+    if (x->t_ns != y->t_ns) {
+        return x->t_ns < y->t_ns ? -1 : 1;
+    }
+    return x < y ? -1 : 1;
+}
+
+static void load_script(replay_t *r, const char *path) {
+    FILE *fp = fopen(path, "r");
+    char buf[256];
+    int line = 0;
+    uint64_t t = 0, hold = 80 * MS, gap = 150 * MS, last_release = 0;
+    int ended = 0;
+
+    if (fp == 0) {
+        perror(path);
+        exit(2);
+    }
+
+    while (fgets(buf, sizeof(buf), fp)) {
+        char *p = buf;
+        line++;
+        while (*p == ' ' || *p == '\t') p++;
+        strip_comment(p);
+        if (*p == '\0') {
+            continue;
+        }
+
+        char cmd[16] = "";
+        int n = 0;
+        sscanf(p, "%15s %n", cmd, &n);
+        char *arg = p + n;
+
+        if (strcmp(cmd, "hold") == 0) {
+            hold = strtoull(arg, 0, 10) * MS;
+        } else if (strcmp(cmd, "gap") == 0) {
+            gap = strtoull(arg, 0, 10) * MS;
+        } else if (strcmp(cmd, "wait") == 0) {
+            t += strtoull(arg, 0, 10) * MS;
+        } else if (strcmp(cmd, "keys") == 0) {
+            for (char *k = arg; *k; k++) {
+                if (*k == ' ') continue;
+                if (!strchr("0123456789*#", *k)) {
+                    fprintf(stderr, "%s:%d: invalid key '%c'\n", path, line, *k);
+                    exit(2);
+                }
+                add_item(r, t, ITEM_KEY_DOWN, line)->key = *k;
+                add_item(r, t + hold, ITEM_KEY_UP, line);
+                last_release = t + hold;
+                t += hold + gap;
+            }
+        } else if (strcmp(cmd, "expect") == 0) {
+            item_t *it = add_item(r, t, ITEM_EXPECT, line);
+            if (parse_cond(arg, &it->cond) != 0) {
+                fprintf(stderr, "%s:%d: bad expect\n", path, line);
+                exit(2);
+            }
+        } else if (strcmp(cmd, "within") == 0) {
+            char *end;
+            uint64_t budget = strtoull(arg, &end, 10) * MS;
+            item_t *it = add_item(r, last_release, ITEM_WITHIN, line);
+            it->budget_ns = budget;
+            if (end == arg || parse_cond(end, &it->cond) != 0) {
+                fprintf(stderr, "%s:%d: bad within\n", path, line);
+                exit(2);
+            }
+            if (last_release + budget > t) {
+                t = last_release + budget;   // 예산이 끝나기 전에 시나리오가 끝나지 않도록
+            }
+        } else if (strcmp(cmd, "end") == 0) {
+            add_item(r, t, ITEM_END, line);
+            ended = 1;
+            break;
+        } else {
+            fprintf(stderr, "%s:%d: unknown command '%s'\n", path, line, cmd);
+            exit(2);
+        }
+    }
+    fclose(fp);
+
+    if (!ended) {
+        add_item(r, t, ITEM_END, line);
+    }
+    qsort(r->items, (size_t)r->count, sizeof(item_t), cmp_items);
+}
+
+// -------------------------------------------------------------------------
+// 5. main
+// -------------------------------------------------------------------------
+
+int main(int argc, char **argv) {
+    static sim_unit_t unit;
+    static timer0_t timer0;
+    const char *script = 0;
+    int exact = 0;
+    struct timespec t0, t1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-q") == 0) {
+            replay.quiet = 1;
+        } else if (strcmp(argv[i], "-x") == 0) {
+            exact = 1;
+        } else {
+            script = argv[i];
+        }
+    }
+    if (script == 0) {
+        fprintf(stderr, "usage: %s [-q] [-x] <script>\n", argv[0]);
+        return 2;
+    }
+
+    load_script(&replay, script);
+
+    sim_unit_init(&unit, REPLAY_F_CPU);
+    sim_bind_vectors(&unit);
+    lockboard_init(&replay.board);
+    replay.board.idle_skip = !exact;
+    replay.board.on_change = on_board_change;
+    replay.board.user = &replay;
+    timer0_init(&timer0);
+    if (!exact) {                       // -x: 모든 틱을 ISR로 실행 (건너뛰기 결과와 비교용)
+        timer0_fold(&timer0, &timer_ticks, &timer_handler_due, &timer_wake_due);
+    }
+    sim_attach(&unit, &timer0_periph, &timer0);
+    sim_attach(&unit, &lockboard_periph, &replay.board);
+    sim_attach(&unit, &agenda_periph, &replay);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (sim_run(&unit, firmware_main)) {
+        printf("  FAIL    firmware main() returned\n");
+        replay.failures++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    trace_flush(&replay);
+
+    double wall_ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) / 1e6;
+    double virt_ms = (double)unit.now_ns / MS;
+    const hd44780_t *lcd = &replay.board.lcd;
+
+    printf("\n");
+    printf("virtual time   : %.3f s\n", virt_ms / 1e3);
+    printf("wall time      : %.3f ms (x%.0f)\n", wall_ms, wall_ms > 0 ? virt_ms / wall_ms : 0.0);
+    printf("keys           : %u\n", replay.board.key_presses);
+    printf("io accesses    : %llu, delay calls %llu, isr calls %llu\n",
+           (unsigned long long)unit.io_accesses, (unsigned long long)unit.delay_calls,
+           (unsigned long long)unit.isr_calls);
+    printf("boot (board)   : reset -> \"%s\" %.3f ms\n", REPLAY_PROMPT, (double)replay.prompt_ns / MS);
+    if (boot_trace.done) {
+        static const char *const phases[BOOT_PHASE_COUNT] = {
+            "timer", "ports", "lcd ready", "lcd init", "prompt", "first idle"
+        };
+        printf("boot (fw)      :");
+        for (int p = 0; p < BOOT_PHASE_COUNT; p++) {
+            printf("%s %s %.3f", p ? "," : "", phases[p], boot_phase_us((boot_phase_t)p) / 1e3);
+        }
+        printf(" ms\n");
+    }
+    printf("lcd            : %u commands, %u data, %u busy violations, %u before power-on wait\n",
+           lcd->commands, lcd->data_writes, lcd->busy_violations, lcd->early_writes);
+    uint64_t slept_ns = 0;
+    for (int m = 0; m < SIM_SLEEP_MODES; m++) {
+        slept_ns += unit.sleep_ns[m];
+    }
+    printf("sleep (board)  : active %.3f s, idle %.3f s, power-down %.3f s (%llu sleeps)\n",
+           (double)(unit.now_ns - slept_ns) / 1e9, (double)unit.sleep_ns[SIM_SLEEP_IDLE] / 1e9,
+           (double)unit.sleep_ns[SIM_SLEEP_PWR_DOWN] / 1e9, (unsigned long long)unit.sleeps);
+    printf("sleep (fw)     : active %.3f s, idle %.3f s, power-down x%lu\n",
+           power_residency_ms(POWER_MODE_ACTIVE) / 1e3, power_residency_ms(POWER_MODE_IDLE) / 1e3,
+           power_stats.entries[POWER_MODE_POWER_DOWN]);
+    printf("checks         : %d, failures %d\n", replay.checks, replay.failures);
+
+    return replay.failures ? 1 : 0;
+}
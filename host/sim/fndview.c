@@ -0,0 +1,154 @@
+// =========================================================================
+// 파일명: fndview.c
+// 기능: FND 잔상 모델 구현
+//       포트 값이 바뀔 때마다 직전 상태가 유지된 시간을 켜진 자리/세그먼트에 더한 뒤 새 상태를 반영합니다.
+// =========================================================================
+
+#include "fndview.h"
+
+#include <string.h>
+
+const fndview_cfg_t fndview_porta_c = { 0x3B, 0x35, 4, 0, 1, 0, 0 };
+const fndview_cfg_t fndview_portb_g = { 0x38, 0x65, 4, 0, 1, 0, 1 };
+
+void fndview_init(fndview_t *v, const fndview_cfg_t *cfg) {
+    memset(v, 0, sizeof(*v));
+    v->cfg = *cfg;
+}
+
+// 포트 값 → 켜진 세그먼트 / 선택된 자리 (왼쪽부터 비트 0)
+static uint8_t fndview_seg(const fndview_t *v, uint8_t port) {
+    return v->cfg.seg_on ? port : (uint8_t)~port;
+}
+
+static uint8_t fndview_lit(const fndview_t *v, uint8_t port) {
+    uint8_t lit = 0;
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        if (((port >> (v->cfg.dig_pin0 + i)) & 1) == v->cfg.dig_on) {
+            lit |= (uint8_t)(1 << (v->cfg.right_first ? v->cfg.digits - 1 - i : i));
+        }
+    }
+    return lit;
+}
+
+// last_ns ~ now_ns 동안 지금 상태가 유지되었다고 보고 적분합니다.
+static void fndview_integrate(fndview_t *v, uint64_t now_ns) {
+    uint64_t dt = now_ns - v->last_ns;
+
+    if (now_ns <= v->last_ns) {
+        return;
+    }
+    v->last_ns = now_ns;
+    if (v->lit == 0) {
+        v->dark_ns += dt;
+        return;
+    }
+    if (v->lit & (v->lit - 1)) {
+        v->overlap_ns += dt;
+    }
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        fndview_digit_t *d = &v->d[i];
+        if (!(v->lit & (1 << i))) {
+            continue;
+        }
+        d->on_ns += dt;
+        for (uint8_t b = 0; b < 8; b++) {
+            if (v->seg & (1 << b)) {
+                d->seg_ns[b] += dt;
+            }
+        }
+    }
+}
+
+static void fndview_gap(uint64_t *worst, uint64_t since, uint64_t now_ns) {
+    if (now_ns - since > *worst) {
+        *worst = now_ns - since;
+    }
+}
+
+void fndview_reset(fndview_t *v, uint64_t now_ns) {
+    fndview_cfg_t cfg = v->cfg;
+    uint8_t seg = v->seg;
+    uint8_t lit = v->lit;
+
+    fndview_init(v, &cfg);
+    v->seg = seg;
+    v->lit = lit;
+    v->start_ns = now_ns;
+    v->last_ns = now_ns;
+    v->dark_since_ns = now_ns;
+    for (uint8_t i = 0; i < cfg.digits; i++) {
+        v->d[i].open_ns = now_ns;
+        v->d[i].change_ns = now_ns;
+        v->d[i].off_ns = now_ns;
+    }
+}
+
+void fndview_sync(fndview_t *v, uint64_t now_ns) {
+    fndview_integrate(v, now_ns);
+    for (uint8_t i = 0; i < v->cfg.digits; i++) {
+        if (!(v->lit & (1 << i))) {
+            fndview_gap(&v->d[i].worst_gap_ns, v->d[i].off_ns, now_ns);
+        }
+    }
+    if (v->lit == 0) {
+        fndview_gap(&v->worst_dark_ns, v->dark_since_ns, now_ns);
+    }
+}
+
+static void fndview_on_write(sim_unit_t *u, void *ctx, uint16_t addr, uint8_t old_val, uint8_t new_val) {
+    fndview_t *v = (fndview_t *)ctx;
+    uint64_t now = u->now_ns;
+    (void)old_val;
+
+    if (addr == v->cfg.seg_addr) {
+        uint8_t seg = fndview_seg(v, new_val);
+        if (seg == v->seg) {
+            return;
+        }
+        fndview_integrate(v, now);
+        v->writes++;
+        v->seg = seg;
+        for (uint8_t i = 0; i < v->cfg.digits; i++) {
+            if (v->lit & (1 << i)) {
+                v->d[i].ghost_writes++;
+                v->d[i].change_ns = now;
+            }
+        }
+    } else if (addr == v->cfg.dig_addr) {
+        uint8_t lit = fndview_lit(v, new_val);
+        uint8_t on = (uint8_t)(lit & ~v->lit);
+        uint8_t off = (uint8_t)(v->lit & ~lit);
+        if (lit == v->lit) {
+            return;
+        }
+        fndview_integrate(v, now);
+        v->writes++;
+        if (v->lit == 0) {
+            fndview_gap(&v->worst_dark_ns, v->dark_since_ns, now);
+        } else if (lit == 0) {
+            v->dark_since_ns = now;
+        }
+        for (uint8_t i = 0; i < v->cfg.digits; i++) {
+            fndview_digit_t *d = &v->d[i];
+            if (on & (1 << i)) {
+                fndview_gap(&d->worst_gap_ns, d->off_ns, now);
+                d->windows++;
+                d->open_ns = now;
+                d->change_ns = now;
+            } else if (off & (1 << i)) {
+                d->ghost_ns += d->change_ns - d->open_ns;
+                d->off_ns = now;
+            }
+        }
+        v->lit = lit;
+    }
+}
+
+const sim_periph_t fndview_periph = {
+    "fndview",
+    fndview_on_write,
+    0,
+    0,
+    0
+};
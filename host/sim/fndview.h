@@ -0,0 +1,70 @@
+// =========================================================================
+// 파일명: fndview.h
+// 기능: 다자리 7-Segment(FND) 잔상(persistence of vision) 모델
+//       - 세그먼트 포트와 자리 선택 포트 쓰기를 가상 시각과 함께 관찰해 자리별/세그먼트별 켜진 시간을 적분합니다.
+//       - 자리마다 켜진 횟수(갱신 빈도), 켜진 비율(duty), 가장 길게 꺼져 있던 구간(dark gap)을 기록합니다.
+//       - 잔상(ghosting): 자리가 켜져 있는 동안 세그먼트 값이 바뀌면, 그 자리가 꺼질 때 보이던 최종 패턴이 아닌
+//         패턴으로 켜져 있던 시간(창이 열린 시각 ~ 마지막 변경)을 잔상 시간으로 집계합니다.
+//         자리를 먼저 고르고 세그먼트를 나중에 쓰면 앞 자리의 패턴이 잠깐 비치는 것이 여기에 잡힙니다.
+//       - DDR은 보지 않습니다. (두 포트 모두 출력으로 설정되어 있다고 가정)
+// =========================================================================
+
+#ifndef FNDVIEW_H_
+#define FNDVIEW_H_
+
+#include <stdint.h>
+#include "sim.h"
+
+#define FNDVIEW_MAX_DIGITS  8
+
+// 배선 (Common/fnd/fnd.h의 FND_BOARD 묶음과 같은 의미)
+typedef struct {
+    uint8_t seg_addr;           // 세그먼트 a~g, dp 포트 (비트 0~7)
+    uint8_t dig_addr;           // 자리 선택 포트
+    uint8_t digits;             // 자리 수
+    uint8_t dig_pin0;           // 첫 자리 선택 핀 (자리 선택은 연속한 핀)
+    uint8_t seg_on;             // 세그먼트가 켜지는 레벨 (0/1)
+    uint8_t dig_on;             // 자리가 선택되는 레벨 (0/1)
+    uint8_t right_first;        // 1이면 가장 낮은 핀이 오른쪽 자리
+} fndview_cfg_t;
+
+extern const fndview_cfg_t fndview_porta_c;    // PORTA 세그먼트, PC0(천의 자리)~PC3 (Day9 ~ Day11)
+extern const fndview_cfg_t fndview_portb_g;    // PORTB 세그먼트, PG0(일의 자리)~PG3 (Day6 FND2, Day7 FND3)
+
+// 자리별 기록 (자리 번호는 왼쪽부터 0)
+typedef struct {
+    uint64_t seg_ns[8];         // 세그먼트별 켜진 시간 (자리 선택 중이고 세그먼트가 켜진 시간)
+    uint64_t on_ns;             // 자리가 선택되어 있던 시간
+    uint32_t windows;           // 자리가 켜진 횟수 (꺼짐 → 켜짐)
+    uint64_t open_ns;           // 지금 켜져 있는 창이 열린 시각
+    uint64_t change_ns;         // 창 안에서 세그먼트가 마지막으로 바뀐 시각 (바뀌지 않았으면 open_ns)
+    uint64_t off_ns;            // 마지막으로 꺼진 시각 (관찰 시작 시 꺼져 있었으면 시작 시각)
+    uint64_t worst_gap_ns;      // 가장 길게 꺼져 있던 구간
+    uint64_t ghost_ns;          // 최종 패턴이 아닌 패턴으로 켜져 있던 시간
+    uint32_t ghost_writes;      // 켜져 있는 동안 세그먼트가 바뀐 횟수
+} fndview_digit_t;
+
+typedef struct {
+    fndview_cfg_t cfg;
+    uint64_t start_ns;          // 관찰 시작 시각
+    uint64_t last_ns;           // 마지막으로 적분한 시각
+    uint8_t  seg;               // 지금 켜진 세그먼트 (1 = 켜짐)
+    uint8_t  lit;               // 지금 선택된 자리 (비트 n = 왼쪽에서 n번째 자리)
+    fndview_digit_t d[FNDVIEW_MAX_DIGITS];
+
+    uint64_t overlap_ns;        // 두 자리 이상이 동시에 선택되어 있던 시간
+    uint64_t dark_ns;           // 어느 자리도 선택되지 않았던 시간
+    uint64_t dark_since_ns;     // 모든 자리가 꺼진 시각
+    uint64_t worst_dark_ns;     // 화면 전체가 가장 길게 꺼져 있던 구간
+    uint32_t writes;            // 관찰한 포트 쓰기 수
+} fndview_t;
+
+extern const sim_periph_t fndview_periph;
+
+void fndview_init(fndview_t *v, const fndview_cfg_t *cfg);
+// 지금 포트 상태는 그대로 두고 기록만 now_ns부터 다시 시작합니다. (초기화 구간을 빼고 잴 때)
+void fndview_reset(fndview_t *v, uint64_t now_ns);
+// now_ns까지 적분하고, 진행 중인 꺼진 구간도 최장 구간 계산에 반영합니다. (통계를 읽기 전에 호출)
+void fndview_sync(fndview_t *v, uint64_t now_ns);
+
+#endif /* FNDVIEW_H_ */
@@ -0,0 +1,107 @@
+// =========================================================================
+// 파일명: hd44780.c
+// 기능: HD44780 명령 해석과 DDRAM 갱신
+// =========================================================================
+
+#include "hd44780.h"
+
+#include <string.h>
+
+void hd44780_reset(hd44780_t *lcd) {
+    memset(lcd, 0, sizeof(*lcd));
+    memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+    lcd->increment = 1;
+    lcd->ready_ns = HD44780_POWER_ON_NS;
+}
+
+// 2라인 모드의 DDRAM 주소 증가/감소 (0x27 → 0x40, 0x67 → 0x00)
+static uint8_t hd44780_step(uint8_t ac, int inc) {
+    if (inc) {
+        if (ac == 0x27) return 0x40;
+        if (ac == 0x67) return 0x00;
+        return (uint8_t)(ac + 1);
+    }
+    if (ac == 0x00) return 0x67;
+    if (ac == 0x40) return 0x27;
+    return (uint8_t)(ac - 1);
+}
+
+// 주소가 현재 보이는 16칸 안에 있는지 (표시 시프트는 사용하지 않는다고 가정)
+static int hd44780_visible(uint8_t addr) {
+    return (addr < HD44780_COLS) || (addr >= 0x40 && addr < 0x40 + HD44780_COLS);
+}
+
+int hd44780_write(hd44780_t *lcd, uint64_t now_ns, int rs, uint8_t value) {
+    int changed = 0;
+
+    if (now_ns < HD44780_POWER_ON_NS) {
+        lcd->early_writes++;
+    } else if (now_ns < lcd->ready_ns) {
+        lcd->busy_violations++;
+    }
+
+    if (rs) {
+        lcd->data_writes++;
+        lcd->ready_ns = now_ns + HD44780_DATA_NS;
+        if (lcd->to_cgram) {
+            return 0;   // 사용자 정의 문자는 모델링하지 않음
+        }
+        if (lcd->ddram[lcd->ac] != value && hd44780_visible(lcd->ac)) {
+            changed = 1;
+        }
+        lcd->ddram[lcd->ac] = value;
+        lcd->ac = hd44780_step(lcd->ac, lcd->increment);
+        return changed;
+    }
+
+    lcd->commands++;
+    lcd->ready_ns = now_ns + HD44780_CMD_NS;
+
+    if (value & 0x80) {                 // Set DDRAM address
+        lcd->ac = value & 0x7F;
+        lcd->to_cgram = 0;
+    } else if (value & 0x40) {          // Set CGRAM address
+        lcd->to_cgram = 1;
+    } else if (value & 0x20) {          // Function set
+        lcd->function_set = 1;
+    } else if (value & 0x10) {          // Cursor/display shift
+        if (!(value & 0x08)) {
+            lcd->ac = hd44780_step(lcd->ac, value & 0x04);
+        }
+    } else if (value & 0x08) {          // Display on/off control
+        changed = lcd->display_on != ((value >> 2) & 1);
+        lcd->display_on = (value >> 2) & 1;
+        lcd->cursor_on = (value >> 1) & 1;
+    } else if (value & 0x04) {          // Entry mode set
+        lcd->increment = (value >> 1) & 1;
+    } else if (value & 0x02) {          // Return home
+        lcd->ac = 0;
+        lcd->to_cgram = 0;
+        lcd->ready_ns = now_ns + HD44780_CLEAR_NS;
+    } else if (value & 0x01) {          // Clear display
+        for (int i = 0; i < (int)sizeof(lcd->ddram); i++) {
+            if (lcd->ddram[i] != ' ' && hd44780_visible((uint8_t)i)) {
+                changed = 1;
+            }
+        }
+        memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+        lcd->ac = 0;
+        lcd->increment = 1;
+        lcd->to_cgram = 0;
+        lcd->ready_ns = now_ns + HD44780_CLEAR_NS;
+    }
+    return changed;
+}
+
+void hd44780_row(const hd44780_t *lcd, int row, char out[HD44780_COLS + 1]) {
+    const uint8_t *src = &lcd->ddram[row ? 0x40 : 0x00];
+    int len = HD44780_COLS;
+
+    for (int i = 0; i < HD44780_COLS; i++) {
+        out[i] = (src[i] >= 0x20 && src[i] < 0x7F) ? (char)src[i] : '?';
+    }
+    while (len > 0 && out[len - 1] == ' ') {
+        len--;
+    }
+    out[len] = '\0';
+}
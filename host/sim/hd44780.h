@@ -0,0 +1,43 @@
+// =========================================================================
+// 파일명: hd44780.h
+// 기능: 2x16 텍스트 LCD(HD44780 호환) 컨트롤러 모델
+//       - EN 하강 에지에서 래치된 명령/데이터를 받아 DDRAM을 갱신합니다.
+//       - 데이터시트의 실행 시간(클리어 1.52ms, 그 외 37us)과 전원 인가 후 대기 시간을
+//         기준으로, 컨트롤러가 바쁜 동안 들어온 쓰기를 위반으로 집계합니다.
+// =========================================================================
+
+#ifndef HD44780_H_
+#define HD44780_H_
+
+#include <stdint.h>
+
+#define HD44780_COLS            16
+#define HD44780_ROWS            2
+#define HD44780_POWER_ON_NS     15000000ULL // 전원 인가 후 첫 명령까지 필요한 시간 (15ms, VCC 4.5V 기준)
+#define HD44780_CLEAR_NS        1520000ULL  // Clear/Return Home 실행 시간
+#define HD44780_CMD_NS          37000ULL    // 일반 명령 실행 시간
+#define HD44780_DATA_NS         41000ULL    // 데이터 쓰기 (37us + tADD 4us)
+
+typedef struct {
+    uint8_t  ddram[0x80];       // 표시 데이터 RAM (1행: 0x00~, 2행: 0x40~)
+    uint8_t  ac;                // 주소 카운터
+    uint8_t  to_cgram;          // 마지막 주소 설정이 CGRAM이었는지 여부
+    uint8_t  increment;         // Entry mode I/D
+    uint8_t  display_on;
+    uint8_t  cursor_on;
+    uint8_t  function_set;      // Function Set을 받은 적이 있는지
+    uint64_t ready_ns;          // 이 시각 이후부터 다음 명령을 받을 수 있음
+
+    uint32_t commands;          // 받은 명령 수
+    uint32_t data_writes;       // 받은 데이터 수
+    uint32_t busy_violations;   // 실행 중에 들어온 쓰기
+    uint32_t early_writes;      // 전원 인가 대기 시간 이전의 쓰기
+} hd44780_t;
+
+void hd44780_reset(hd44780_t *lcd);
+// 래치된 쓰기 1회를 처리합니다. 화면에 보이는 내용이 바뀌면 1을 반환합니다.
+int  hd44780_write(hd44780_t *lcd, uint64_t now_ns, int rs, uint8_t value);
+// 지정 행에 보이는 16글자를 out에 채웁니다. (끝의 공백은 제거, NUL 종료)
+void hd44780_row(const hd44780_t *lcd, int row, char out[HD44780_COLS + 1]);
+
+#endif /* HD44780_H_ */
@@ -0,0 +1,34 @@
+// =========================================================================
+// 파일명: avr/interrupt.h (호스트 시뮬레이션용)
+// 기능: sei()/cli()와 ISR() 매크로를 가상 MCU에 연결합니다.
+//       - ISR(TIMER0_COMP_vect)는 __vector_15라는 일반 함수로 정의되며,
+//         시뮬레이터가 가상 시간에 맞춰 직접 호출합니다.
+// =========================================================================
+
+#ifndef SIM_AVR_INTERRUPT_H_
+#define SIM_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+void sim_sei(void);     // SREG의 I 비트 세트 (sim.c)
+void sim_cli(void);     // SREG의 I 비트 클리어
+
+#define sei()   sim_sei()
+#define cli()   sim_cli()
+#define reti()  return
+
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+#define ISR_ALIASOF(v)
+
+// ISR(vector, 속성...) → void __vector_N(void)
+#define ISR(vector, ...) \
+    void vector(void); \
+    void vector(void)
+
+#define EMPTY_INTERRUPT(vector) \
+    void vector(void); \
+    void vector(void) {}
+
+#endif /* SIM_AVR_INTERRUPT_H_ */
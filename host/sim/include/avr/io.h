@@ -0,0 +1,395 @@
+// =========================================================================
+// 파일명: avr/io.h (호스트 시뮬레이션용)
+// 기능: ATmega128 I/O 레지스터를 가상 레지스터 파일로 대체합니다.
+//       - 펌웨어 소스(main.c, lcd.c ...)를 수정 없이 PC에서 컴파일하기 위한 헤더
+//       - 모든 레지스터 접근은 sim_io8()/sim_io16()을 거치므로,
+//         시뮬레이터가 포트 쓰기(LCD EN 하강 에지 등)와 핀 읽기(키패드)를 관찰할 수 있습니다.
+//       - 주소는 ATmega128 데이터 메모리 주소(0x20 ~ 0xFF)를 그대로 사용합니다.
+// =========================================================================
+
+#ifndef SIM_AVR_IO_H_
+#define SIM_AVR_IO_H_
+
+#include <stdint.h>
+
+#define __AVR_ATmega128__ 1
+#define SIM_HOST 1                  // 호스트 빌드 여부 (펌웨어에서 #ifdef SIM_HOST로 구분 가능)
+
+volatile uint8_t  *sim_io8(uint16_t addr);   // 8비트 레지스터 접근 (sim.c)
+volatile uint16_t *sim_io16(uint16_t addr);  // 16비트 레지스터 접근 (L/H 쌍)
+
+#define _SFR_MEM8(addr)  (*sim_io8(addr))
+#define _SFR_MEM16(addr) (*sim_io16(addr))
+#define _BV(bit)         (1 << (bit))
+
+// -------------------------------------------------------------------------
+// 1. 포트 레지스터 (PORTx / DDRx / PINx)
+// -------------------------------------------------------------------------
+#define PINF    _SFR_MEM8(0x20)
+#define PINE    _SFR_MEM8(0x21)
+#define DDRE    _SFR_MEM8(0x22)
+#define PORTE   _SFR_MEM8(0x23)
+#define PIND    _SFR_MEM8(0x30)
+#define DDRD    _SFR_MEM8(0x31)
+#define PORTD   _SFR_MEM8(0x32)
+#define PINC    _SFR_MEM8(0x33)
+#define DDRC    _SFR_MEM8(0x34)
+#define PORTC   _SFR_MEM8(0x35)
+#define PINB    _SFR_MEM8(0x36)
+#define DDRB    _SFR_MEM8(0x37)
+#define PORTB   _SFR_MEM8(0x38)
+#define PINA    _SFR_MEM8(0x39)
+#define DDRA    _SFR_MEM8(0x3A)
+#define PORTA   _SFR_MEM8(0x3B)
+#define DDRF    _SFR_MEM8(0x61)
+#define PORTF   _SFR_MEM8(0x62)
+#define PING    _SFR_MEM8(0x63)
+#define DDRG    _SFR_MEM8(0x64)
+#define PORTG   _SFR_MEM8(0x65)
+
+// -------------------------------------------------------------------------
+// 2. ADC / USART / 기타
+// -------------------------------------------------------------------------
+#define ADCW    _SFR_MEM16(0x24)
+#define ADC     _SFR_MEM16(0x24)
+#define ADCL    _SFR_MEM8(0x24)
+#define ADCH    _SFR_MEM8(0x25)
+#define ADCSRA  _SFR_MEM8(0x26)
+#define ADMUX   _SFR_MEM8(0x27)
+#define UBRR0L  _SFR_MEM8(0x29)
+#define UCSR0B  _SFR_MEM8(0x2A)
+#define UCSR0A  _SFR_MEM8(0x2B)
+#define UDR0    _SFR_MEM8(0x2C)
+#define UBRR0H  _SFR_MEM8(0x90)
+#define UCSR0C  _SFR_MEM8(0x95)
+#define UBRR1H  _SFR_MEM8(0x98)
+#define UBRR1L  _SFR_MEM8(0x99)
+#define UCSR1B  _SFR_MEM8(0x9A)
+#define UCSR1A  _SFR_MEM8(0x9B)
+#define UDR1    _SFR_MEM8(0x9C)
+#define UCSR1C  _SFR_MEM8(0x9D)
+#define SFIOR   _SFR_MEM8(0x40)
+#define WDTCR   _SFR_MEM8(0x41)
+#define MCUCSR  _SFR_MEM8(0x54)
+#define MCUCR   _SFR_MEM8(0x55)
+#define EIFR    _SFR_MEM8(0x58)
+#define EIMSK   _SFR_MEM8(0x59)
+#define EICRB   _SFR_MEM8(0x5A)
+#define SREG    _SFR_MEM8(0x5F)
+#define EICRA   _SFR_MEM8(0x6A)
+
+// -------------------------------------------------------------------------
+// 3. 타이머/카운터 레지스터
+// -------------------------------------------------------------------------
+#define OCR2    _SFR_MEM8(0x43)
+#define TCNT2   _SFR_MEM8(0x44)
+#define TCCR2   _SFR_MEM8(0x45)
+#define ICR1    _SFR_MEM16(0x46)
+#define ICR1L   _SFR_MEM8(0x46)
+#define ICR1H   _SFR_MEM8(0x47)
+#define OCR1B   _SFR_MEM16(0x48)
+#define OCR1BL  _SFR_MEM8(0x48)
+#define OCR1BH  _SFR_MEM8(0x49)
+#define OCR1A   _SFR_MEM16(0x4A)
+#define OCR1AL  _SFR_MEM8(0x4A)
+#define OCR1AH  _SFR_MEM8(0x4B)
+#define TCNT1   _SFR_MEM16(0x4C)
+#define TCNT1L  _SFR_MEM8(0x4C)
+#define TCNT1H  _SFR_MEM8(0x4D)
+#define TCCR1B  _SFR_MEM8(0x4E)
+#define TCCR1A  _SFR_MEM8(0x4F)
+#define ASSR    _SFR_MEM8(0x50)
+#define OCR0    _SFR_MEM8(0x51)
+#define TCNT0   _SFR_MEM8(0x52)
+#define TCCR0   _SFR_MEM8(0x53)
+#define TIFR    _SFR_MEM8(0x56)
+#define TIMSK   _SFR_MEM8(0x57)
+#define OCR1C   _SFR_MEM16(0x78)
+#define OCR1CL  _SFR_MEM8(0x78)
+#define OCR1CH  _SFR_MEM8(0x79)
+#define TCCR1C  _SFR_MEM8(0x7A)
+#define ETIFR   _SFR_MEM8(0x7C)
+#define ETIMSK  _SFR_MEM8(0x7D)
+#define ICR3    _SFR_MEM16(0x80)
+#define ICR3L   _SFR_MEM8(0x80)
+#define ICR3H   _SFR_MEM8(0x81)
+#define OCR3C   _SFR_MEM16(0x82)
+#define OCR3CL  _SFR_MEM8(0x82)
+#define OCR3CH  _SFR_MEM8(0x83)
+#define OCR3B   _SFR_MEM16(0x84)
+#define OCR3BL  _SFR_MEM8(0x84)
+#define OCR3BH  _SFR_MEM8(0x85)
+#define OCR3A   _SFR_MEM16(0x86)
+#define OCR3AL  _SFR_MEM8(0x86)
+#define OCR3AH  _SFR_MEM8(0x87)
+#define TCNT3   _SFR_MEM16(0x88)
+#define TCNT3L  _SFR_MEM8(0x88)
+#define TCNT3H  _SFR_MEM8(0x89)
+#define TCCR3B  _SFR_MEM8(0x8A)
+#define TCCR3A  _SFR_MEM8(0x8B)
+#define TCCR3C  _SFR_MEM8(0x8C)
+
+// -------------------------------------------------------------------------
+// 4. 핀 번호 (PA0 ~ PG4)
+// -------------------------------------------------------------------------
+#define PA0 0
+#define PA1 1
+#define PA2 2
+#define PA3 3
+#define PA4 4
+#define PA5 5
+#define PA6 6
+#define PA7 7
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PC7 7
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+#define PE0 0
+#define PE1 1
+#define PE2 2
+#define PE3 3
+#define PE4 4
+#define PE5 5
+#define PE6 6
+#define PE7 7
+#define PF0 0
+#define PF1 1
+#define PF2 2
+#define PF3 3
+#define PF4 4
+#define PF5 5
+#define PF6 6
+#define PF7 7
+#define PG0 0
+#define PG1 1
+#define PG2 2
+#define PG3 3
+#define PG4 4
+
+// -------------------------------------------------------------------------
+// 5. 레지스터 비트 이름
+// -------------------------------------------------------------------------
+// TCCR0
+#define FOC0    7
+#define WGM00   6
+#define COM01   5
+#define COM00   4
+#define WGM01   3
+#define CS02    2
+#define CS01    1
+#define CS00    0
+// TCCR2
+#define FOC2    7
+#define WGM20   6
+#define COM21   5
+#define COM20   4
+#define WGM21   3
+#define CS22    2
+#define CS21    1
+#define CS20    0
+// TIMSK / TIFR
+#define OCIE2   7
+#define TOIE2   6
+#define TICIE1  5
+#define OCIE1A  4
+#define OCIE1B  3
+#define TOIE1   2
+#define OCIE0   1
+#define TOIE0   0
+#define OCF2    7
+#define TOV2    6
+#define ICF1    5
+#define OCF1A   4
+#define OCF1B   3
+#define TOV1    2
+#define OCF0    1
+#define TOV0    0
+// ETIMSK / ETIFR
+#define TICIE3  5
+#define OCIE3A  4
+#define OCIE3B  3
+#define TOIE3   2
+#define OCIE3C  1
+#define OCIE1C  0
+#define ICF3    5
+#define OCF3A   4
+#define OCF3B   3
+#define TOV3    2
+#define OCF3C   1
+#define OCF1C   0
+// TCCR1A/B/C, TCCR3A/B/C
+#define COM1A1  7
+#define COM1A0  6
+#define COM1B1  5
+#define COM1B0  4
+#define COM1C1  3
+#define COM1C0  2
+#define WGM11   1
+#define WGM10   0
+#define ICNC1   7
+#define ICES1   6
+#define WGM13   4
+#define WGM12   3
+#define CS12    2
+#define CS11    1
+#define CS10    0
+#define FOC1A   7
+#define FOC1B   6
+#define FOC1C   5
+#define COM3A1  7
+#define COM3A0  6
+#define COM3B1  5
+#define COM3B0  4
+#define COM3C1  3
+#define COM3C0  2
+#define WGM31   1
+#define WGM30   0
+#define ICNC3   7
+#define ICES3   6
+#define WGM33   4
+#define WGM32   3
+#define CS32    2
+#define CS31    1
+#define CS30    0
+#define FOC3A   7
+#define FOC3B   6
+#define FOC3C   5
+// ASSR
+#define AS0     3
+#define TCN0UB  2
+#define OCR0UB  1
+#define TCR0UB  0
+// MCUCR (슬립 제어 포함)
+#define SRE     7
+#define SRW10   6
+#define SE      5
+#define SM1     4
+#define SM0     3
+#define SM2     2
+#define IVSEL   1
+#define IVCE    0
+// EICRA / EIMSK / EIFR
+#define ISC31   7
+#define ISC30   6
+#define ISC21   5
+#define ISC20   4
+#define ISC11   3
+#define ISC10   2
+#define ISC01   1
+#define ISC00   0
+#define INT7    7
+#define INT6    6
+#define INT5    5
+#define INT4    4
+#define INT3    3
+#define INT2    2
+#define INT1    1
+#define INT0    0
+#define INTF7   7
+#define INTF6   6
+#define INTF5   5
+#define INTF4   4
+#define INTF3   3
+#define INTF2   2
+#define INTF1   1
+#define INTF0   0
+// ADCSRA / ADMUX
+#define ADEN    7
+#define ADSC    6
+#define ADFR    5
+#define ADIF    4
+#define ADIE    3
+#define ADPS2   2
+#define ADPS1   1
+#define ADPS0   0
+#define REFS1   7
+#define REFS0   6
+#define ADLAR   5
+// UCSRnA / UCSRnB / UCSRnC
+#define RXC0    7
+#define TXC0    6
+#define UDRE0   5
+#define U2X0    1
+#define RXCIE0  7
+#define TXCIE0  6
+#define UDRIE0  5
+#define RXEN0   4
+#define TXEN0   3
+#define UCSZ02  2
+#define UCSZ01  2
+#define UCSZ00  1
+#define RXC1    7
+#define TXC1    6
+#define UDRE1   5
+#define U2X1    1
+#define RXCIE1  7
+#define TXCIE1  6
+#define UDRIE1  5
+#define RXEN1   4
+#define TXEN1   3
+#define UCSZ12  2
+#define UCSZ11  2
+#define UCSZ10  1
+// SREG
+#define SREG_I  7
+
+// -------------------------------------------------------------------------
+// 6. 인터럽트 벡터 (ATmega128 벡터 번호 그대로)
+// -------------------------------------------------------------------------
+#define INT0_vect           __vector_1
+#define INT1_vect           __vector_2
+#define INT2_vect           __vector_3
+#define INT3_vect           __vector_4
+#define INT4_vect           __vector_5
+#define INT5_vect           __vector_6
+#define INT6_vect           __vector_7
+#define INT7_vect           __vector_8
+#define TIMER2_COMP_vect    __vector_9
+#define TIMER2_OVF_vect     __vector_10
+#define TIMER1_CAPT_vect    __vector_11
+#define TIMER1_COMPA_vect   __vector_12
+#define TIMER1_COMPB_vect   __vector_13
+#define TIMER1_OVF_vect     __vector_14
+#define TIMER0_COMP_vect    __vector_15
+#define TIMER0_OVF_vect     __vector_16
+#define SPI_STC_vect        __vector_17
+#define USART0_RX_vect      __vector_18
+#define USART0_UDRE_vect    __vector_19
+#define USART0_TX_vect      __vector_20
+#define ADC_vect            __vector_21
+#define EE_READY_vect       __vector_22
+#define ANALOG_COMP_vect    __vector_23
+#define TIMER1_COMPC_vect   __vector_24
+#define TIMER3_CAPT_vect    __vector_25
+#define TIMER3_COMPA_vect   __vector_26
+#define TIMER3_COMPB_vect   __vector_27
+#define TIMER3_COMPC_vect   __vector_28
+#define TIMER3_OVF_vect     __vector_29
+#define USART1_RX_vect      __vector_30
+#define USART1_UDRE_vect    __vector_31
+#define USART1_TX_vect      __vector_32
+#define TWI_vect            __vector_33
+#define SPM_READY_vect      __vector_34
+#define _VECTORS_SIZE_N     35
+
+#endif /* SIM_AVR_IO_H_ */
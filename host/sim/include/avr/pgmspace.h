@@ -0,0 +1,26 @@
+// =========================================================================
+// 파일명: avr/pgmspace.h (호스트 시뮬레이션용)
+// 기능: 플래시에 두는 상수 표(PROGMEM)와 pgm_read_xxx()를 일반 메모리 읽기로 대체합니다.
+//       - PC에는 별도의 프로그램 메모리 공간이 없으므로 const 배열을 그대로 읽습니다.
+// =========================================================================
+
+#ifndef SIM_AVR_PGMSPACE_H_
+#define SIM_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P                   const char *
+#define PSTR(s)                 (s)
+
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)    (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr)      (*(void *const *)(addr))
+
+#define memcpy_P(dst, src, n)   memcpy((dst), (src), (n))
+#define strlen_P(s)             strlen(s)
+#define strcmp_P(a, b)          strcmp((a), (b))
+
+#endif /* SIM_AVR_PGMSPACE_H_ */
@@ -0,0 +1,30 @@
+// =========================================================================
+// 파일명: avr/sleep.h (호스트 시뮬레이션용)
+// 기능: set_sleep_mode()/sleep_enable()/sleep_cpu()를 가상 MCU에 연결합니다.
+//       - 모드 선택과 SE 비트는 실제와 같이 MCUCR에 기록되고,
+//         sleep_cpu()는 코어를 깨울 수 있는 인터럽트가 올 때까지 가상 시간을 진행합니다.
+// =========================================================================
+
+#ifndef SIM_AVR_SLEEP_H_
+#define SIM_AVR_SLEEP_H_
+
+#include <avr/io.h>
+
+void sim_sleep(void);   // sleep 명령 (sim.c)
+
+#define SLEEP_MODE_IDLE         0
+#define SLEEP_MODE_ADC          _BV(SM0)
+#define SLEEP_MODE_PWR_DOWN     _BV(SM1)
+#define SLEEP_MODE_PWR_SAVE     (_BV(SM0) | _BV(SM1))
+#define SLEEP_MODE_STANDBY      (_BV(SM1) | _BV(SM2))
+#define SLEEP_MODE_EXT_STANDBY  (_BV(SM0) | _BV(SM1) | _BV(SM2))
+
+#define set_sleep_mode(mode) \
+    do { MCUCR = (uint8_t)((MCUCR & ~(_BV(SM0) | _BV(SM1) | _BV(SM2))) | (mode)); } while (0)
+#define sleep_enable()  do { MCUCR |= _BV(SE); } while (0)
+#define sleep_disable() do { MCUCR &= (uint8_t)~_BV(SE); } while (0)
+#define sleep_cpu()     sim_sleep()
+#define sleep_mode() \
+    do { sleep_enable(); sleep_cpu(); sleep_disable(); } while (0)
+
+#endif /* SIM_AVR_SLEEP_H_ */
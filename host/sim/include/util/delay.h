@@ -0,0 +1,24 @@
+// =========================================================================
+// 파일명: util/delay.h (호스트 시뮬레이션용)
+// 기능: _delay_ms()/_delay_us()를 가상 시간 진행으로 대체합니다.
+//       - 실제로 기다리지 않고 가상 시계만 앞으로 보내므로,
+//         수 분 분량의 사용 시나리오가 수 밀리초 안에 재생됩니다.
+//       - 지연 중에 도래하는 인터럽트는 시뮬레이터가 그 시각에 맞춰 실행합니다.
+// =========================================================================
+
+#ifndef SIM_UTIL_DELAY_H_
+#define SIM_UTIL_DELAY_H_
+
+#include <stdint.h>
+
+void sim_delay_ns(uint64_t ns); // 가상 시간을 ns 단위로 진행 (sim.c)
+
+static inline void _delay_ms(double ms) {
+    sim_delay_ns((uint64_t)(ms * 1000000.0));
+}
+
+static inline void _delay_us(double us) {
+    sim_delay_ns((uint64_t)(us * 1000.0));
+}
+
+#endif /* SIM_UTIL_DELAY_H_ */
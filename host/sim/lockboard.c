@@ -0,0 +1,154 @@
+// =========================================================================
+// 파일명: lockboard.c
+// 기능: 도어락 보드 모델 구현 (키패드 행렬, LCD 버스, LED)
+// =========================================================================
+
+#include "lockboard.h"
+
+#include <string.h>
+#include <strings.h>
+
+#define LOCKBOARD_IDLE_QUIET_NS 1000000ULL  // 키 상태가 바뀐 뒤 이 시간이 지나야 폴링 건너뛰기 허용 (1ms)
+
+// keypad.c의 keypad_map과 같은 배치 (행 PD0~PD3, 컬럼 PD4~PD6)
+static const char lockboard_keys[4][3] = {
+    {'1', '2', '3'},
+    {'4', '5', '6'},
+    {'7', '8', '9'},
+    {'*', '0', '#'}
+};
+
+static const char *const lockboard_led_names[8] = {
+    "OFF", "RED", "GREEN", "YELLOW", "BLUE", "MAGENTA", "CYAN", "WHITE"
+};
+
+void lockboard_init(lockboard_t *b) {
+    memset(b, 0, sizeof(*b));
+    hd44780_reset(&b->lcd);
+    b->idle_skip = 1;
+}
+
+static void lockboard_changed(lockboard_t *b, sim_unit_t *u) {
+    if (b->on_change) {
+        b->on_change(b, u, b->user);
+    }
+}
+
+// 출력 핀 상태로부터 현재 LED 색상을 계산합니다. (DDR=1이고 PORT=0인 핀이 점등)
+static uint8_t lockboard_led_from_port(const sim_unit_t *u) {
+    return (uint8_t)(u->io[SIM_ADDR_DDRE] & ~u->io[SIM_ADDR_PORTE] & 0x07);
+}
+
+// 눌린 키와 HIGH로 구동 중인 컬럼으로부터 행(PD0~PD3) 입력 레벨을 계산합니다.
+// 폴링마다 불리므로 키의 행/컬럼 비트는 누를 때 한 번만 찾아 둡니다. (lockboard_locate)
+static uint8_t lockboard_rows(const lockboard_t *b, const sim_unit_t *u) {
+    uint8_t port = u->io[SIM_ADDR_PORTD] & u->io[SIM_ADDR_DDRD];
+    uint8_t rows = (port & b->key_col) ? b->key_row : 0;
+    return (uint8_t)(rows & ~u->io[SIM_ADDR_DDRD]);
+}
+
+// 키 배치에서 key의 행 비트(PD0~PD3)와 컬럼 비트(PD4~PD6)를 찾습니다. 없는 키는 둘 다 0
+static void lockboard_locate(lockboard_t *b, char key) {
+    b->key_row = 0;
+    b->key_col = 0;
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 3; c++) {
+            if (key != '\0' && lockboard_keys[r][c] == key) {
+                b->key_row = (uint8_t)(1 << r);
+                b->key_col = (uint8_t)(0x10 << c);
+            }
+        }
+    }
+}
+
+// 행 핀은 INT0~INT3이기도 하므로, 레벨이 바뀌면 외부 인터럽트 에지로 전달합니다. (파워다운 깨우기)
+// 컬럼 스캔마다 불리므로 레벨이 바뀐 핀만 전달합니다.
+static void lockboard_update_pins(lockboard_t *b, sim_unit_t *u) {
+    uint8_t rows = lockboard_rows(b, u);
+    for (uint8_t diff = (uint8_t)((rows ^ u->int_level) & 0x0F); diff; diff &= (uint8_t)(diff - 1)) {
+        uint8_t n = (uint8_t)__builtin_ctz(diff);
+        sim_int_pin(u, n, (uint8_t)((rows >> n) & 1));
+    }
+}
+
+static void lockboard_on_write(sim_unit_t *u, void *ctx, uint16_t addr, uint8_t old_val, uint8_t new_val) {
+    lockboard_t *b = (lockboard_t *)ctx;
+
+    if (addr == SIM_ADDR_PORTG) {
+        // EN(PG2) 하강 에지에서 RS/RW와 PORTC 값을 래치
+        if ((old_val & 0x04) && !(new_val & 0x04) && !(new_val & 0x02)) {
+            if (hd44780_write(&b->lcd, u->now_ns, new_val & 0x01, u->io[SIM_ADDR_PORTC])) {
+                b->lcd_updates++;
+                lockboard_changed(b, u);
+            }
+        }
+    } else if (addr == SIM_ADDR_PORTE || addr == SIM_ADDR_DDRE) {
+        uint8_t led = lockboard_led_from_port(u);
+        if (led != b->led) {
+            b->led = led;
+            b->led_updates++;
+            lockboard_changed(b, u);
+        }
+    } else if (addr == SIM_ADDR_PORTD || addr == SIM_ADDR_DDRD) {
+        lockboard_update_pins(b, u);
+    }
+}
+
+static void lockboard_on_read(sim_unit_t *u, void *ctx, uint16_t addr) {
+    lockboard_t *b = (lockboard_t *)ctx;
+
+    if (addr != SIM_ADDR_PIND) {
+        return;
+    }
+
+    // 키 상태가 한동안 그대로라면 펌웨어는 같은 값을 반복해서 읽는 중(입력 대기 또는 키 떼기 대기)이므로,
+    // 입력이 바뀔 수 있는 다음 이벤트 시각까지 건너뜁니다. 상태가 막 바뀐 직후의 읽기는 그대로 둡니다.
+    // 슬립으로 기다리는 펌웨어는 폴링 사이에 이미 시간을 건너뛰므로 적용하지 않습니다.
+    if (b->idle_skip && u->sleeps == 0 && u->now_ns - b->last_input_ns >= LOCKBOARD_IDLE_QUIET_NS) {
+        sim_skip_idle(u);
+    }
+
+    u->io[SIM_ADDR_PIND] = (uint8_t)((u->io[SIM_ADDR_PORTD] & u->io[SIM_ADDR_DDRD]) | lockboard_rows(b, u));
+}
+
+// LCD 제어(PORTG, EN 에지에서 PORTC를 래치), LED(PORTE/DDRE), 키패드(PORTD/DDRD 출력, PIND 입력)
+static const uint8_t lockboard_regs[] = {
+    SIM_ADDR_PORTG, SIM_ADDR_PORTE, SIM_ADDR_DDRE, SIM_ADDR_PORTD, SIM_ADDR_DDRD, SIM_ADDR_PIND, 0
+};
+
+const sim_periph_t lockboard_periph = {
+    "lockboard",
+    lockboard_on_write,
+    lockboard_on_read,
+    0,
+    0,
+    lockboard_regs
+};
+
+void lockboard_press(lockboard_t *b, sim_unit_t *u, char key) {
+    b->key = key;
+    lockboard_locate(b, key);
+    b->key_presses++;
+    b->last_input_ns = u->now_ns;
+    lockboard_update_pins(b, u);
+}
+
+void lockboard_release(lockboard_t *b, sim_unit_t *u) {
+    b->key = '\0';
+    lockboard_locate(b, '\0');
+    b->last_input_ns = u->now_ns;
+    lockboard_update_pins(b, u);
+}
+
+const char *lockboard_led_name(uint8_t led) {
+    return lockboard_led_names[led & 0x07];
+}
+
+int lockboard_led_parse(const char *name) {
+    for (int i = 0; i < 8; i++) {
+        if (strcasecmp(name, lockboard_led_names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,47 @@
+// =========================================================================
+// 파일명: lockboard.h
+// 기능: Project1.4 도어락 보드 배선 모델
+//       - LCD: 데이터 PORTC, 제어 PORTG (PG0=RS, PG1=RW, PG2=EN)
+//       - 키패드: 컬럼 PD4~PD6 출력(HIGH 선택), 행 PD0~PD3 입력(눌리면 HIGH, INT0~INT3 겸용)
+//       - 풀컬러 LED: PE0=R, PE1=G, PE2=B (핀이 LOW일 때 점등)
+// =========================================================================
+
+#ifndef LOCKBOARD_H_
+#define LOCKBOARD_H_
+
+#include "sim.h"
+#include "hd44780.h"
+
+#define LOCKBOARD_LED_R     0x01
+#define LOCKBOARD_LED_G     0x02
+#define LOCKBOARD_LED_B     0x04
+
+typedef struct lockboard lockboard_t;
+typedef void (*lockboard_change_fn)(lockboard_t *b, sim_unit_t *u, void *user);
+
+struct lockboard {
+    hd44780_t lcd;
+    char     key;               // 현재 눌려 있는 키 ('\0' = 없음)
+    uint8_t  key_row;           // 눌린 키의 행 비트 (PD0~PD3, 없으면 0)
+    uint8_t  key_col;           // 눌린 키의 컬럼 비트 (PD4~PD6, 없으면 0)
+    uint8_t  led;               // 현재 LED 색상 (LOCKBOARD_LED_x 조합)
+    uint8_t  idle_skip;         // 입력이 변하지 않는 폴링 구간을 건너뛸지 여부
+    uint64_t last_input_ns;     // 마지막으로 키 상태가 바뀐 시각
+
+    uint32_t key_presses;
+    uint32_t lcd_updates;
+    uint32_t led_updates;
+
+    lockboard_change_fn on_change;  // LCD/LED 표시가 바뀔 때 호출
+    void    *user;
+};
+
+extern const sim_periph_t lockboard_periph;
+
+void lockboard_init(lockboard_t *b);
+void lockboard_press(lockboard_t *b, sim_unit_t *u, char key);
+void lockboard_release(lockboard_t *b, sim_unit_t *u);
+const char *lockboard_led_name(uint8_t led);
+int  lockboard_led_parse(const char *name);   // 실패 시 -1
+
+#endif /* LOCKBOARD_H_ */
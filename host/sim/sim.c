@@ -0,0 +1,504 @@
+// =========================================================================
+// 파일명: sim.c
+// 기능: 가상 ATmega128 코어 구현
+//       - 레지스터 접근 시 직전 쓰기의 변화를 주변장치 모델에 전달 (sync)
+//       - 가상 시계 진행과 이벤트/인터럽트 처리 (advance)
+//       - 펌웨어의 main()을 실행하고 시나리오 종료 시 longjmp로 빠져나옴 (run/stop)
+// =========================================================================
+
+#include "sim.h"
+
+#include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/delay.h>
+
+__thread sim_unit_t *sim_cur;
+
+// 정적 링크 빌드에서는 펌웨어에 정의된 ISR만 실제 주소를 가지고, 나머지는 NULL입니다.
+#define SIM_WEAK_VECTOR(n) extern void __vector_##n(void) __attribute__((weak));
+SIM_WEAK_VECTOR(1)  SIM_WEAK_VECTOR(2)  SIM_WEAK_VECTOR(3)  SIM_WEAK_VECTOR(4)
+SIM_WEAK_VECTOR(5)  SIM_WEAK_VECTOR(6)  SIM_WEAK_VECTOR(7)  SIM_WEAK_VECTOR(8)
+SIM_WEAK_VECTOR(9)  SIM_WEAK_VECTOR(10) SIM_WEAK_VECTOR(11) SIM_WEAK_VECTOR(12)
+SIM_WEAK_VECTOR(13) SIM_WEAK_VECTOR(14) SIM_WEAK_VECTOR(15) SIM_WEAK_VECTOR(16)
+SIM_WEAK_VECTOR(17) SIM_WEAK_VECTOR(18) SIM_WEAK_VECTOR(19) SIM_WEAK_VECTOR(20)
+SIM_WEAK_VECTOR(21) SIM_WEAK_VECTOR(22) SIM_WEAK_VECTOR(23) SIM_WEAK_VECTOR(24)
+SIM_WEAK_VECTOR(25) SIM_WEAK_VECTOR(26) SIM_WEAK_VECTOR(27) SIM_WEAK_VECTOR(28)
+SIM_WEAK_VECTOR(29) SIM_WEAK_VECTOR(30) SIM_WEAK_VECTOR(31) SIM_WEAK_VECTOR(32)
+SIM_WEAK_VECTOR(33) SIM_WEAK_VECTOR(34)
+
+static sim_isr_t const sim_linked_vectors[SIM_VECTOR_COUNT] = {
+    0,
+    __vector_1,  __vector_2,  __vector_3,  __vector_4,  __vector_5,  __vector_6,
+    __vector_7,  __vector_8,  __vector_9,  __vector_10, __vector_11, __vector_12,
+    __vector_13, __vector_14, __vector_15, __vector_16, __vector_17, __vector_18,
+    __vector_19, __vector_20, __vector_21, __vector_22, __vector_23, __vector_24,
+    __vector_25, __vector_26, __vector_27, __vector_28, __vector_29, __vector_30,
+    __vector_31, __vector_32, __vector_33, __vector_34
+};
+
+/**
+ * @brief 유닛을 리셋 직후 상태로 초기화합니다. (레지스터 0, 가상 시각 0)
+ */
+void sim_unit_init(sim_unit_t *u, uint32_t f_cpu) {
+    memset(u, 0, sizeof(*u));
+    u->f_cpu = f_cpu;
+    u->cycle_ps = (uint32_t)(1000000000000ULL / f_cpu);
+    u->cycles_per_io = 2;
+    u->next_event_ns = SIM_NEVER;
+}
+
+int sim_attach(sim_unit_t *u, const sim_periph_t *p, void *ctx) {
+    uint8_t bit = (uint8_t)(1 << u->periph_count);
+
+    if (u->periph_count >= SIM_MAX_PERIPHS) {
+        return -1;
+    }
+    if (p->on_write || p->on_read) {
+        if (p->regs) {
+            for (const uint8_t *r = p->regs; *r; r++) {
+                u->watchers[*r] |= bit;
+            }
+        } else {
+            for (uint16_t a = 0; a < SIM_IO_SIZE; a++) {
+                u->watchers[a] |= bit;
+            }
+        }
+    }
+    u->periph[u->periph_count] = p;
+    u->periph_ctx[u->periph_count] = ctx;
+    u->periph_count++;
+    sim_reschedule(u);
+    return 0;
+}
+
+void sim_bind_vectors(sim_unit_t *u) {
+    memcpy(u->vectors, sim_linked_vectors, sizeof(u->vectors));
+}
+
+void sim_reschedule(sim_unit_t *u) {
+    uint64_t next = SIM_NEVER;
+    for (uint8_t i = 0; i < u->periph_count; i++) {
+        if (u->periph[i]->next_event) {
+            uint64_t t = u->periph[i]->next_event(u, u->periph_ctx[i]);
+            if (t < next) {
+                next = t;
+            }
+        }
+    }
+    u->next_event_ns = next;
+}
+
+// 플래그/마스크 레지스터로 관리되는 인터럽트 (벡터 번호, 플래그 레지스터, 마스크 레지스터, 비트)
+typedef struct {
+    uint8_t vector;
+    uint8_t flag_addr;
+    uint8_t mask_addr;
+    uint8_t bit;
+} sim_irq_src_t;
+
+static const sim_irq_src_t sim_irq_srcs[] = {
+    { 1,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT0 },
+    { 2,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT1 },
+    { 3,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT2 },
+    { 4,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT3 },
+    { 5,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT4 },
+    { 6,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT5 },
+    { 7,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT6 },
+    { 8,  SIM_ADDR_EIFR, SIM_ADDR_EIMSK, INT7 },
+    { 12, SIM_ADDR_TIFR, SIM_ADDR_TIMSK, OCF1A },
+    { 13, SIM_ADDR_TIFR, SIM_ADDR_TIMSK, OCF1B },
+    { 14, SIM_ADDR_TIFR, SIM_ADDR_TIMSK, TOV1 },
+    { 15, SIM_ADDR_TIFR, SIM_ADDR_TIMSK, OCF0 },
+    { 16, SIM_ADDR_TIFR, SIM_ADDR_TIMSK, TOV0 },
+    { 26, SIM_ADDR_ETIFR, SIM_ADDR_ETIMSK, OCF3A },
+    { 27, SIM_ADDR_ETIFR, SIM_ADDR_ETIMSK, OCF3B },
+    { 29, SIM_ADDR_ETIFR, SIM_ADDR_ETIMSK, TOV3 },
+};
+#define SIM_IRQ_SRC_COUNT   (sizeof(sim_irq_srcs) / sizeof(sim_irq_srcs[0]))
+
+static const sim_irq_src_t *sim_irq_src(uint8_t vector) {
+    for (uint8_t i = 0; i < SIM_IRQ_SRC_COUNT; i++) {
+        if (sim_irq_srcs[i].vector == vector) {
+            return &sim_irq_srcs[i];
+        }
+    }
+    return 0;
+}
+
+// 코어가 직접 처리하는 레지스터 쓰기: 플래그는 1을 써서 지우고, 마스크를 켜면 세워져 있던 플래그가 인터럽트가 됨
+static void sim_core_write(sim_unit_t *u, uint16_t a, uint8_t old_val, uint8_t new_val) {
+    if (a == SIM_ADDR_EIFR || a == SIM_ADDR_TIFR || a == SIM_ADDR_ETIFR) {
+        u->io[a] = (uint8_t)(old_val & ~new_val);
+        return;
+    }
+    if (a == SIM_ADDR_EIMSK || a == SIM_ADDR_TIMSK || a == SIM_ADDR_ETIMSK) {
+        uint8_t enabled = (uint8_t)(new_val & ~old_val);
+        for (uint8_t i = 0; i < SIM_IRQ_SRC_COUNT; i++) {
+            const sim_irq_src_t *s = &sim_irq_srcs[i];
+            if (s->mask_addr == a && (enabled & (1 << s->bit)) && (u->io[s->flag_addr] & (1 << s->bit))) {
+                sim_irq_raise(u, s->vector);
+            }
+        }
+    }
+}
+
+// 주소 a의 값이 바뀌었으면 그 주소를 보는 주변장치 모델에 알립니다.
+// 알린 모델 중 next_event가 있는 모델이 있으면 1 (다음 이벤트 시각을 다시 구해야 함)
+static uint8_t sim_notify(sim_unit_t *u, uint16_t a) {
+    uint8_t old_val = u->seen[a];
+    uint8_t timed = 0;
+
+    sim_core_write(u, a, old_val, u->io[a]);
+    u->seen[a] = u->io[a];
+    for (uint8_t m = u->watchers[a]; m; m &= (uint8_t)(m - 1)) {
+        uint8_t i = (uint8_t)__builtin_ctz(m);
+        if (u->periph[i]->on_write) {
+            u->periph[i]->on_write(u, u->periph_ctx[i], a, old_val, u->io[a]);
+        }
+        if (u->periph[i]->next_event) {
+            timed = 1;
+        }
+    }
+    return timed;
+}
+
+// 주소 addr를 보는 주변장치 모델에 읽기를 알립니다. (입력 레지스터 값 갱신)
+static inline void sim_read_hooks(sim_unit_t *u, uint16_t addr) {
+    for (uint8_t m = u->watchers[addr]; m; m &= (uint8_t)(m - 1)) {
+        uint8_t i = (uint8_t)__builtin_ctz(m);
+        if (u->periph[i]->on_read) {
+            u->periph[i]->on_read(u, u->periph_ctx[i], addr);
+        }
+    }
+}
+
+/**
+ * @brief 마지막 동기화 이후 바뀐 레지스터를 찾아 주변장치 모델에 알립니다.
+ *        펌웨어는 sim_io8()이 돌려준 포인터로 직접 쓰기 때문에,
+ *        쓰기의 효과는 "다음 레지스터 접근" 또는 "지연 호출" 시점에 반영됩니다.
+ *        (그 사이에는 가상 시간이 흐르지 않으므로 타이밍 오차는 없습니다.)
+ *        펌웨어가 쓸 수 있는 곳은 그 사이에 건넨 포인터뿐이므로 그 주소들만 비교하고,
+ *        추적 목록이 넘쳤을 때만 레지스터 파일 전체를 비교합니다.
+ *        다음 이벤트 시각은 바뀐 값을 받은 모델 중 next_event가 있는 모델이 있을 때만 다시 구합니다.
+ *        (LCD 버스, 키패드 컬럼 같은 쓰기는 일정을 건드리지 않음)
+ */
+static void sim_sync_touched(sim_unit_t *u) {
+    uint8_t n = u->touched_count;
+    uint8_t changed = 0;
+
+    u->touched_count = 0;
+    if (n > SIM_MAX_TOUCHED) {
+        for (uint16_t a = 0; a < SIM_IO_SIZE; a++) {
+            if (u->io[a] != u->seen[a]) {
+                changed |= sim_notify(u, a);
+            }
+        }
+    } else {
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t a = u->touched[i];
+            if (u->io[a] != u->seen[a]) {
+                changed |= sim_notify(u, a);
+            }
+        }
+    }
+    if (changed) {
+        sim_reschedule(u);
+    }
+}
+
+// 레지스터 접근마다 불리므로, 건넨 포인터가 없으면 호출 없이 지나갑니다.
+static inline void sim_sync(sim_unit_t *u) {
+    if (u->touched_count) {
+        sim_sync_touched(u);
+    }
+}
+
+// 펌웨어에 건넨 레지스터 포인터를 다음 sync의 비교 대상으로 등록합니다.
+static void sim_touch(sim_unit_t *u, uint16_t addr) {
+    if (u->touched_count < SIM_MAX_TOUCHED) {
+        u->touched[u->touched_count] = (uint8_t)addr;
+    }
+    if (u->touched_count <= SIM_MAX_TOUCHED) {
+        u->touched_count++;
+    }
+}
+
+// 슬립 중인 코어를 깨웁니다. (체류 시간 집계, clkIO가 멈춰 있던 시간 누적)
+static void sim_wake(sim_unit_t *u) {
+    uint64_t slept;
+    if (!u->sleeping) {
+        return;
+    }
+    slept = u->now_ns - u->sleep_start_ns;
+    u->sleep_ns[u->sleep_mode] += slept;
+    if (u->sleep_mode != SIM_SLEEP_IDLE) {
+        u->clk_io_stopped_ns += slept;
+    }
+    u->sleeping = 0;
+    sim_reschedule(u);
+}
+
+/**
+ * @brief 인터럽트가 허용되어 있으면 대기 중인 인터럽트를 벡터 번호 순(우선순위 순)으로 실행합니다.
+ *        Idle 외의 슬립 모드에서는 외부 인터럽트(INT0~7)만 코어를 깨울 수 있습니다.
+ */
+static void sim_dispatch_pending(sim_unit_t *u) {
+    for (;;) {
+        uint64_t pending = u->irq_pending;
+        if (u->sleeping && u->sleep_mode != SIM_SLEEP_IDLE) {
+            pending &= 0x1FEULL;
+        }
+        if (pending == 0 || !(u->io[SIM_ADDR_SREG] & (1 << SREG_I))) {
+            break;
+        }
+        uint8_t vec = (uint8_t)__builtin_ctzll(pending);
+        const sim_irq_src_t *src = sim_irq_src(vec);
+        u->irq_pending &= ~(1ULL << vec);
+        if (src) {
+            // 대기 중에 플래그가 지워졌거나 마스크가 꺼졌으면 실행하지 않음. 실행할 때는 하드웨어처럼 플래그 클리어
+            if (!(u->io[src->flag_addr] & u->io[src->mask_addr] & (1 << src->bit))) {
+                continue;
+            }
+            u->io[src->flag_addr] &= (uint8_t)~(1 << src->bit);
+            u->seen[src->flag_addr] = u->io[src->flag_addr];
+        }
+        if (u->vectors[vec] == 0) {
+            u->lost_irqs++;
+            continue;
+        }
+        sim_wake(u);
+        // 하드웨어와 동일하게 ISR 진입 시 I 비트 클리어, reti에서 다시 세트
+        u->io[SIM_ADDR_SREG] &= (uint8_t)~(1 << SREG_I);
+        u->seen[SIM_ADDR_SREG] = u->io[SIM_ADDR_SREG];
+        u->in_isr++;
+        u->isr_calls++;
+        u->vectors[vec]();
+        sim_sync(u);
+        u->in_isr--;
+        u->io[SIM_ADDR_SREG] |= (1 << SREG_I);
+        u->seen[SIM_ADDR_SREG] = u->io[SIM_ADDR_SREG];
+    }
+}
+
+// 레지스터 접근마다 불리므로, 대기 중인 인터럽트가 없으면 호출 없이 지나갑니다.
+static inline void sim_dispatch_irq(sim_unit_t *u) {
+    if (u->irq_pending) {
+        sim_dispatch_pending(u);
+    }
+}
+
+void sim_irq_raise(sim_unit_t *u, uint8_t vector) {
+    if (vector < SIM_VECTOR_COUNT) {
+        u->irq_pending |= (1ULL << vector);
+    }
+}
+
+void sim_irq_flag(sim_unit_t *u, uint8_t vector) {
+    const sim_irq_src_t *src = sim_irq_src(vector);
+    if (src == 0) {
+        sim_irq_raise(u, vector);
+        return;
+    }
+    u->io[src->flag_addr] |= (uint8_t)(1 << src->bit);
+    u->seen[src->flag_addr] = u->io[src->flag_addr];
+    if (u->io[src->mask_addr] & (1 << src->bit)) {
+        sim_irq_raise(u, vector);
+    }
+}
+
+void sim_int_pin(sim_unit_t *u, uint8_t n, uint8_t level) {
+    uint8_t bit = (uint8_t)(1 << n);
+    uint8_t prev = (u->int_level & bit) ? 1 : 0;
+    uint8_t isc;
+
+    level = level ? 1 : 0;
+    if (n > 7 || level == prev) {
+        return;
+    }
+    u->int_level ^= bit;
+    isc = (n < 4) ? (uint8_t)((u->io[SIM_ADDR_EICRA] >> (2 * n)) & 3)
+                  : (uint8_t)((u->io[SIM_ADDR_EICRB] >> (2 * (n - 4))) & 3);
+    // 10: 하강 에지, 11: 상승 에지, 01: 양쪽 에지(INT4~7만). 00(LOW 레벨)은 모델링하지 않음
+    if ((isc == 3 && level) || (isc == 2 && !level) || (isc == 1 && n >= 4)) {
+        sim_irq_flag(u, (uint8_t)(n + 1));
+    }
+}
+
+/**
+ * @brief 가상 시계를 t_ns까지 진행합니다. 그 사이의 주변장치 이벤트와 인터럽트는 시각 순으로 처리합니다.
+ */
+void sim_advance_to(sim_unit_t *u, uint64_t t_ns) {
+    for (;;) {
+        sim_sync(u);
+        sim_dispatch_irq(u);
+        if (u->next_event_ns > t_ns) {
+            break;
+        }
+        if (u->next_event_ns > u->now_ns) {
+            u->now_ns = u->next_event_ns;
+        }
+        for (uint8_t i = 0; i < u->periph_count; i++) {
+            const sim_periph_t *p = u->periph[i];
+            if (p->next_event && p->on_event && p->next_event(u, u->periph_ctx[i]) <= u->now_ns) {
+                p->on_event(u, u->periph_ctx[i]);
+            }
+        }
+        sim_reschedule(u);
+    }
+    if (u->now_ns < t_ns) {
+        u->now_ns = t_ns;
+    }
+}
+
+void sim_skip_idle(sim_unit_t *u) {
+    if (u->next_event_ns != SIM_NEVER && u->next_event_ns > u->now_ns) {
+        sim_advance_to(u, u->next_event_ns);
+    }
+}
+
+// 레지스터 접근 1회분의 CPU 시간을 소모합니다.
+static inline void sim_charge_io(sim_unit_t *u) {
+    u->io_accesses++;
+    u->cycle_ps_acc += (uint32_t)u->cycles_per_io * u->cycle_ps;
+    if (u->cycle_ps_acc >= 1000) {
+        uint64_t ns = u->cycle_ps_acc / 1000;
+        u->cycle_ps_acc %= 1000;
+        if (u->now_ns + ns >= u->next_event_ns) {
+            sim_advance_to(u, u->now_ns + ns);
+        } else {
+            u->now_ns += ns;
+        }
+    }
+}
+
+volatile uint8_t *sim_io8(uint16_t addr) {
+    sim_unit_t *u = sim_cur;
+    sim_sync(u);
+    sim_dispatch_irq(u);
+    sim_charge_io(u);
+    sim_read_hooks(u, addr);
+    u->seen[addr] = u->io[addr];    // 입력 갱신은 "쓰기"로 취급하지 않음
+    sim_touch(u, addr);
+    return &u->io[addr];
+}
+
+volatile uint16_t *sim_io16(uint16_t addr) {
+    sim_unit_t *u = sim_cur;
+    sim_sync(u);
+    sim_dispatch_irq(u);
+    sim_charge_io(u);
+    sim_read_hooks(u, addr);
+    u->seen[addr] = u->io[addr];
+    u->seen[addr + 1] = u->io[addr + 1];
+    sim_touch(u, addr);
+    sim_touch(u, addr + 1);
+    return (volatile uint16_t *)&u->io[addr];
+}
+
+uint64_t sim_clk_io_ns(const sim_unit_t *u) {
+    if (u->sleeping && u->sleep_mode != SIM_SLEEP_IDLE) {
+        return u->sleep_start_ns - u->clk_io_stopped_ns;
+    }
+    return u->now_ns - u->clk_io_stopped_ns;
+}
+
+const char *sim_sleep_mode_name(uint8_t mode) {
+    static const char *const names[SIM_SLEEP_MODES] = {
+        "idle", "adc", "power-down", "power-save", "reserved", "reserved", "standby", "ext-standby"
+    };
+    return names[mode & (SIM_SLEEP_MODES - 1)];
+}
+
+/**
+ * @brief sleep 명령 (avr/sleep.h의 sleep_cpu()).
+ *        MCUCR의 SE가 켜져 있으면, 코어를 깨울 수 있는 인터럽트의 ISR이 실행될 때까지 가상 시간을 진행합니다.
+ *        clkIO가 멈추는 모드(파워다운 등)에서는 타이머 모델의 시간도 멈춥니다.
+ */
+void sim_sleep(void) {
+    sim_unit_t *u = sim_cur;
+    uint8_t mcucr;
+
+    sim_sync(u);
+    mcucr = u->io[SIM_ADDR_MCUCR];
+    if (!(mcucr & (1 << SE))) {
+        return;
+    }
+    u->sleeping = 1;
+    u->sleep_mode = (uint8_t)(((mcucr >> SM0) & 3) | (((mcucr >> SM2) & 1) << 2));
+    u->sleep_start_ns = u->now_ns;
+    u->sleeps++;
+    sim_reschedule(u);
+
+    sim_dispatch_irq(u);            // 이미 대기 중인 인터럽트가 있으면 바로 깨어남
+    while (u->sleeping && u->next_event_ns != SIM_NEVER) {
+        sim_advance_to(u, u->next_event_ns);
+    }
+    sim_wake(u);                    // 깨울 이벤트가 더 없으면 그대로 반환
+}
+
+/**
+ * @brief 바쁜 대기 (_delay_ms/_delay_us).
+ *        대기 중임을 주변장치 모델에 알려 두고(타이머 모델의 틱 건너뛰기), 끝나면 다시 평소 일정으로 돌립니다.
+ *        평소 일정의 다음 이벤트보다 먼저 끝나는 대기(LCD, 키패드 스캔의 수십 us)는 시각만 옮깁니다.
+ *        대기 중의 일정은 평소 일정을 늦추기만 하므로 그 사이에 처리할 이벤트가 없습니다.
+ */
+void sim_delay_ns(uint64_t ns) {
+    sim_unit_t *u = sim_cur;
+    uint8_t nested = u->in_delay;
+
+    u->delay_calls++;
+    sim_sync(u);
+    sim_dispatch_irq(u);
+    if (u->now_ns + ns < u->next_event_ns) {
+        u->now_ns += ns;
+        return;
+    }
+    u->in_delay = 1;
+    sim_reschedule(u);
+    sim_advance_to(u, u->now_ns + ns);
+    u->in_delay = nested;
+    sim_reschedule(u);
+    sim_advance_to(u, u->now_ns);   // 대기 중에 건너뛴 이벤트를 지금 시각으로 정리
+}
+
+void sim_sei(void) {
+    sim_unit_t *u = sim_cur;
+    sim_sync(u);
+    u->io[SIM_ADDR_SREG] |= (1 << SREG_I);
+    u->seen[SIM_ADDR_SREG] = u->io[SIM_ADDR_SREG];
+    sim_dispatch_irq(u);
+}
+
+void sim_cli(void) {
+    sim_unit_t *u = sim_cur;
+    sim_sync(u);
+    u->io[SIM_ADDR_SREG] &= (uint8_t)~(1 << SREG_I);
+    u->seen[SIM_ADDR_SREG] = u->io[SIM_ADDR_SREG];
+}
+
+/**
+ * @brief 펌웨어 진입 함수(main)를 현재 스레드에서 실행합니다.
+ *        펌웨어는 무한 루프이므로, 시나리오가 끝나면 sim_stop()으로 여기로 돌아옵니다.
+ * @return 0: sim_stop()으로 종료, 1: 펌웨어 main()이 스스로 반환
+ */
+int sim_run(sim_unit_t *u, int (*entry)(void)) {
+    sim_unit_t *prev = sim_cur;
+    int rc = 0;
+    sim_cur = u;
+    u->running = 1;
+    if (setjmp(u->exit_jmp) == 0) {
+        entry();
+        rc = 1;
+    }
+    u->running = 0;
+    sim_cur = prev;
+    return rc;
+}
+
+void sim_stop(sim_unit_t *u) {
+    if (u->running) {
+        sim_wake(u);                // 잠든 채로 멈추면 그 시각까지를 슬립 시간으로 마감
+        longjmp(u->exit_jmp, 1);
+    }
+}
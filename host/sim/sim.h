@@ -0,0 +1,137 @@
+// =========================================================================
+// 파일명: sim.h
+// 기능: 호스트용 가상 ATmega128 코어
+//       - 레지스터 파일(I/O 0x20 ~ 0xFF)과 가상 시계(ns 단위)를 유닛별로 보관합니다.
+//       - 펌웨어의 레지스터 접근/지연 함수는 현재 스레드의 유닛(sim_cur)으로 연결됩니다.
+//       - 보드 모델(LCD, 키패드 등)과 시나리오 구동기는 sim_periph_t로 붙입니다.
+// =========================================================================
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <setjmp.h>
+
+#define SIM_IO_SIZE         0x100          // 가상 I/O 주소 공간 크기
+#define SIM_VECTOR_COUNT    35             // ATmega128 인터럽트 벡터 개수 (리셋 포함)
+#define SIM_MAX_PERIPHS     8              // 유닛당 붙일 수 있는 주변장치 모델 수
+#define SIM_NEVER           UINT64_MAX     // "이벤트 없음"을 나타내는 시각
+#define SIM_MAX_TOUCHED     8              // sync 사이에 추적하는 레지스터 포인터 수 (넘치면 전체 비교)
+
+// 자주 쓰는 레지스터 주소 (avr/io.h와 동일)
+#define SIM_ADDR_PIND       0x30
+#define SIM_ADDR_PORTD      0x32
+#define SIM_ADDR_DDRD       0x31
+#define SIM_ADDR_PORTC      0x35
+#define SIM_ADDR_DDRE       0x22
+#define SIM_ADDR_PORTE      0x23
+#define SIM_ADDR_SREG       0x5F
+#define SIM_ADDR_PORTG      0x65
+#define SIM_ADDR_OCR0       0x51
+#define SIM_ADDR_TCNT0      0x52
+#define SIM_ADDR_TCCR0      0x53
+#define SIM_ADDR_MCUCR      0x55
+#define SIM_ADDR_TIFR       0x56
+#define SIM_ADDR_TIMSK      0x57
+#define SIM_ADDR_EIFR       0x58
+#define SIM_ADDR_EIMSK      0x59
+#define SIM_ADDR_EICRB      0x5A
+#define SIM_ADDR_EICRA      0x6A
+#define SIM_ADDR_ETIFR      0x7C
+#define SIM_ADDR_ETIMSK     0x7D
+
+// 슬립 모드 번호: MCUCR의 SM2:SM1:SM0 (avr/sleep.h의 SLEEP_MODE_x와 같은 조합)
+#define SIM_SLEEP_IDLE          0
+#define SIM_SLEEP_ADC           1
+#define SIM_SLEEP_PWR_DOWN      2
+#define SIM_SLEEP_PWR_SAVE      3
+#define SIM_SLEEP_STANDBY       6
+#define SIM_SLEEP_EXT_STANDBY   7
+#define SIM_SLEEP_MODES         8
+
+typedef struct sim_unit sim_unit_t;
+typedef void (*sim_isr_t)(void);
+
+// 주변장치/보드 모델 인터페이스 (필요 없는 콜백은 NULL)
+typedef struct {
+    const char *name;
+    // 펌웨어가 레지스터 값을 바꾼 직후 호출 (addr, 이전 값, 새 값)
+    void (*on_write)(sim_unit_t *u, void *ctx, uint16_t addr, uint8_t old_val, uint8_t new_val);
+    // 펌웨어가 레지스터를 읽기 직전에 호출 (PINx 입력값 갱신용)
+    void (*on_read)(sim_unit_t *u, void *ctx, uint16_t addr);
+    // 다음 이벤트 시각 (없으면 SIM_NEVER)
+    uint64_t (*next_event)(sim_unit_t *u, void *ctx);
+    // 가상 시계가 next_event 시각에 도달했을 때 호출
+    void (*on_event)(sim_unit_t *u, void *ctx);
+    // on_write/on_read를 받을 레지스터 주소 (0으로 끝나는 목록, NULL이면 모든 주소)
+    // 다른 주소는 콜백 없이 지나가고, next_event는 목록의 주소 값이 바뀌었을 때만 다시 구하므로
+    // next_event가 레지스터 값(TIMSK 등)에 따라 달라지는 모델은 그 주소도 넣어야 합니다.
+    // next_event가 없는 모델의 on_write가 다른 모델의 이벤트를 앞당기면 sim_reschedule()을 직접 부릅니다.
+    const uint8_t *regs;
+} sim_periph_t;
+
+// 가상 MCU 한 대의 전체 상태
+struct sim_unit {
+    uint8_t  io[SIM_IO_SIZE];       // 레지스터 파일 (펌웨어가 직접 읽고 씀)
+    uint8_t  seen[SIM_IO_SIZE];     // 마지막으로 모델에 전달한 레지스터 값
+    uint8_t  touched[SIM_MAX_TOUCHED];  // 마지막 sync 이후 펌웨어에 포인터를 건넨 레지스터 주소
+    uint8_t  touched_count;         // SIM_MAX_TOUCHED보다 크면 다음 sync에서 전체 비교
+
+    uint64_t now_ns;                // 가상 시각 (리셋 후 경과 ns)
+    uint32_t f_cpu;                 // CPU 클럭 (Hz)
+    uint32_t cycle_ps;              // CPU 1클럭 길이 (ps)
+    uint32_t cycle_ps_acc;          // ns 미만 잔여 시간 누적
+    uint8_t  cycles_per_io;         // 레지스터 접근 1회당 소모 클럭 (바쁜 대기 루프도 시간이 흐르도록)
+
+    const sim_periph_t *periph[SIM_MAX_PERIPHS];
+    void    *periph_ctx[SIM_MAX_PERIPHS];
+    uint8_t  periph_count;
+    uint8_t  watchers[SIM_IO_SIZE]; // 주소별로 on_write/on_read를 받을 주변장치 (비트 i = periph[i])
+    uint64_t next_event_ns;         // 모든 주변장치 중 가장 이른 이벤트 시각 (캐시)
+
+    sim_isr_t vectors[SIM_VECTOR_COUNT];  // 벡터 번호 → ISR (없으면 NULL)
+    uint64_t irq_pending;           // 대기 중인 인터럽트 (비트 n = 벡터 n)
+    uint8_t  in_isr;                // ISR 중첩 깊이
+    uint8_t  int_level;             // INT0~7 핀의 현재 레벨 (에지 검출용)
+
+    uint8_t  sleeping;              // sleep 명령 후 인터럽트로 깨어나기 전
+    uint8_t  sleep_mode;            // SIM_SLEEP_x
+    uint64_t sleep_start_ns;
+    uint64_t clk_io_stopped_ns;     // clkIO가 멈춰 있던 시간의 합 (파워다운 등)
+    uint8_t  in_delay;              // _delay_ms/_delay_us 안 (그동안 펌웨어 코드는 ISR만 실행됨)
+
+    jmp_buf  exit_jmp;              // sim_stop()이 돌아갈 지점
+    uint8_t  running;
+
+    // 통계
+    uint64_t io_accesses;           // 레지스터 접근 횟수
+    uint64_t delay_calls;           // _delay_ms/_delay_us 호출 횟수
+    uint64_t isr_calls;             // 실행된 ISR 횟수
+    uint64_t lost_irqs;             // 핸들러가 없는 인터럽트 (실제 보드에서는 리셋)
+    uint64_t sleeps;                // sleep 명령 횟수
+    uint64_t sleep_ns[SIM_SLEEP_MODES];   // 슬립 모드별 체류 시간
+};
+
+extern __thread sim_unit_t *sim_cur;   // 현재 스레드에서 실행 중인 유닛
+
+void     sim_unit_init(sim_unit_t *u, uint32_t f_cpu);
+int      sim_attach(sim_unit_t *u, const sim_periph_t *p, void *ctx);
+void     sim_bind_vectors(sim_unit_t *u);   // 링크된 ISR(__vector_N)을 벡터 표에 등록
+int      sim_run(sim_unit_t *u, int (*entry)(void));
+void     sim_stop(sim_unit_t *u);
+
+void     sim_advance_to(sim_unit_t *u, uint64_t t_ns);
+void     sim_skip_idle(sim_unit_t *u);      // 다음 이벤트 시각까지 가상 시간을 건너뜀
+void     sim_reschedule(sim_unit_t *u);     // 주변장치 상태가 바뀌어 next_event가 달라졌을 때
+void     sim_irq_raise(sim_unit_t *u, uint8_t vector);
+// 인터럽트 플래그를 세웁니다. 해당 마스크 비트가 켜져 있으면 인터럽트가 대기 상태가 되고,
+// ISR이 실행되면 하드웨어처럼 플래그가 지워집니다. (INT0~7, Timer0)
+void     sim_irq_flag(sim_unit_t *u, uint8_t vector);
+// 외부 인터럽트 핀 INTn의 레벨이 바뀌었음을 알립니다. (EICRA/EICRB의 에지 설정에 따라 플래그 세트)
+void     sim_int_pin(sim_unit_t *u, uint8_t n, uint8_t level);
+
+// clkIO 기준 경과 시간 (clkIO가 멈추는 슬립 중에는 흐르지 않음) - 타이머 모델용
+uint64_t sim_clk_io_ns(const sim_unit_t *u);
+const char *sim_sleep_mode_name(uint8_t mode);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,296 @@
+// =========================================================================
+// 파일명: timer0.c
+// 기능: Timer/Counter0 모델 구현
+//       시간은 clkIO 기준 CPU 클럭 수로 다루므로, 14.7456MHz처럼 ns로 나누어떨어지지 않는 클럭에서도
+//       틱이 누적 오차 없이 발생합니다.
+// =========================================================================
+
+#include "timer0.h"
+
+#include <string.h>
+#include <avr/io.h>
+
+static const uint16_t timer0_prescalers[8] = { 0, 1, 8, 32, 64, 128, 256, 1024 };
+
+void timer0_init(timer0_t *t) {
+    memset(t, 0, sizeof(*t));
+    t->next_ns = SIM_NEVER;
+}
+
+void timer0_fold(timer0_t *t, volatile unsigned long *ticks, volatile unsigned long *due,
+                 volatile unsigned long *wake) {
+    t->ticks = ticks;
+    t->due = due;
+    t->wake = wake;
+}
+
+static uint64_t timer0_ns_to_cycle(const sim_unit_t *u, uint64_t ns) {
+    return (ns / 1000000000ULL) * u->f_cpu + (ns % 1000000000ULL) * u->f_cpu / 1000000000ULL;
+}
+
+// 해당 클럭이 시작되는 시각 (올림)
+static uint64_t timer0_cycle_to_ns(const sim_unit_t *u, uint64_t cycle) {
+    return (cycle / u->f_cpu) * 1000000000ULL + ((cycle % u->f_cpu) * 1000000000ULL + u->f_cpu - 1) / u->f_cpu;
+}
+
+static uint16_t timer0_top(const timer0_t *t, const sim_unit_t *u) {
+    return t->ctc ? u->io[SIM_ADDR_OCR0] : 0xFF;
+}
+
+// 지금(clkIO 기준) 카운트 값을 계산하고 그 시점을 새 기준으로 삼습니다.
+static void timer0_rebase(timer0_t *t, const sim_unit_t *u) {
+    uint64_t now = timer0_ns_to_cycle(u, sim_clk_io_ns(u));
+    if (t->prescale && now > t->base_cycle) {
+        uint64_t steps = (now - t->base_cycle) / t->prescale;
+        uint32_t period = (uint32_t)timer0_top(t, u) + 1;
+        uint32_t cnt = t->base_cnt;
+        // TOP보다 큰 값에서 출발했다면 (CTC에서 OCR0를 줄인 경우) 0xFF까지 센 뒤 0으로 돌아감
+        if (cnt > timer0_top(t, u)) {
+            uint64_t to_wrap = 0x100 - cnt;
+            if (steps < to_wrap) {
+                cnt += (uint32_t)steps;
+                steps = 0;
+            } else {
+                steps -= to_wrap;
+                cnt = 0;
+            }
+        }
+        t->base_cnt = (uint8_t)((cnt + steps % period) % period);
+        t->base_cycle += steps * t->prescale;
+    } else {
+        t->base_cycle = now;
+    }
+}
+
+// base 이후 처음으로 비교 일치 또는 오버플로가 일어나는 시각을 구합니다.
+// 데이터시트 타이밍도처럼 OCF0는 TCNT0가 OCR0와 같아진 다음 타이머 클럭에 서고, CTC는 같은 클럭에 0으로 돌아갑니다.
+// 그래서 ISR이 OCR0를 바꾸면 TCNT0가 이미 0부터 세는 이번 주기에 바로 적용됩니다.
+static void timer0_plan(timer0_t *t, const sim_unit_t *u) {
+    uint32_t top = timer0_top(t, u);
+    uint32_t ocr = u->io[SIM_ADDR_OCR0];
+    uint32_t cnt = t->base_cnt;
+    uint32_t to_compare, to_overflow;
+
+    if (t->prescale == 0) {
+        t->next_ns = SIM_NEVER;
+        return;
+    }
+    if (cnt > top) {                // TOP을 지나쳐 있으면 0xFF에서 한 바퀴 돌아옴
+        to_compare = 0x100 - cnt + ocr + 1;
+    } else {
+        to_compare = (ocr >= cnt) ? ocr - cnt + 1 : top + 1 - cnt + ocr + 1;
+    }
+    to_overflow = t->ctc ? UINT32_MAX : 0x100 - cnt;
+    t->next_cycle = t->base_cycle + (uint64_t)(to_compare < to_overflow ? to_compare : to_overflow) * t->prescale;
+    t->next_ns = timer0_cycle_to_ns(u, t->next_cycle);
+}
+
+// CTC 비교 일치 한 주기 (CPU 클럭 수)
+static uint64_t timer0_period(const timer0_t *t, const sim_unit_t *u) {
+    return ((uint64_t)u->io[SIM_ADDR_OCR0] + 1) * t->prescale;
+}
+
+// next_cycle부터 몇 번의 비교 일치가 틱 카운터를 target 전까지만 올리는지
+static uint64_t timer0_ticks_before(const timer0_t *t, unsigned long target) {
+    long left = (long)(target - *t->ticks) - 1;
+    return left > 0 ? (uint64_t)left : 0;
+}
+
+// next_cycle부터 몇 번의 비교 일치가 틱 핸들러를 부르지 않는지 (ISR이 틱 카운터만 올림)
+static uint64_t timer0_handler_quiet(const timer0_t *t) {
+    return timer0_ticks_before(t, *t->due);
+}
+
+// next_cycle부터 다른 주변장치의 다음 이벤트(키 입력 등) 직전 비교 일치 전까지의 수
+// 그 비교 일치는 ISR로 전달해서, 이벤트가 깨어난 펌웨어의 폴링 도중에 일어나는 경우도 그대로 재현합니다.
+static uint64_t timer0_before_event(const timer0_t *t, sim_unit_t *u) {
+    uint64_t next = SIM_NEVER, cycle;
+
+    for (uint8_t i = 0; i < u->periph_count; i++) {
+        if (u->periph_ctx[i] != t && u->periph[i]->next_event) {
+            uint64_t e = u->periph[i]->next_event(u, u->periph_ctx[i]);
+            if (e < next) {
+                next = e;
+            }
+        }
+    }
+    if (next == SIM_NEVER) {
+        return UINT64_MAX;
+    }
+    cycle = timer0_ns_to_cycle(u, next - u->clk_io_stopped_ns);
+    return cycle < t->next_cycle ? 0 : (cycle - t->next_cycle) / timer0_period(t, u);
+}
+
+// next_cycle부터 ISR 없이 건너뛰어도 되는 비교 일치 수
+// ISR이 바로 실행될 수 있는 상태(I 비트 세트, 대기 중인 OCF0 없음)이고 그 사이에 펌웨어 코드가 돌지 않을 때만 건너뜁니다.
+static uint64_t timer0_quiet(const timer0_t *t, sim_unit_t *u) {
+    uint64_t quiet, handler;
+
+    if (t->ticks == 0 || !t->ctc || t->prescale == 0 || u->in_isr ||
+        !(u->io[SIM_ADDR_SREG] & (1 << SREG_I)) || !(u->io[SIM_ADDR_TIMSK] & (1 << OCIE0)) ||
+        (u->io[SIM_ADDR_TIFR] & (1 << OCF0))) {
+        return 0;
+    }
+    if (u->sleeping) {
+        // 슬립 루프는 깨어날 틱 전에는 ISR에서 돌아와 레지스터를 건드리지 않고 다시 잠듦
+        if (u->sleep_mode != SIM_SLEEP_IDLE || t->wake == 0) {
+            return 0;
+        }
+        quiet = timer0_ticks_before(t, *t->wake);
+    } else if (u->in_delay) {
+        quiet = UINT32_MAX;
+    } else {
+        return 0;
+    }
+    handler = timer0_handler_quiet(t);
+    if (handler < quiet) {
+        quiet = handler;
+    }
+    if (quiet) {
+        uint64_t before = timer0_before_event(t, u);
+        if (before < quiet) {
+            quiet = before;
+        }
+    }
+    return quiet;
+}
+
+// 비교 일치 n번을 ISR이 실행된 것처럼 지나갑니다. (틱 카운터만 올리고 OCF0는 세우지 않음)
+// 슬립 루프에서는 비교 일치마다 깨어나 sleep 명령을 다시 실행하므로 그 횟수도 더합니다.
+static void timer0_credit(timer0_t *t, sim_unit_t *u, uint64_t n) {
+    *t->ticks += n;
+    t->compares += (uint32_t)n;
+    t->folded += n;
+    if (u->sleeping) {
+        u->sleeps += n;
+    }
+    t->base_cycle = t->next_cycle + (n - 1) * timer0_period(t, u);
+    t->base_cnt = 0;
+    timer0_plan(t, u);
+}
+
+// 지금까지 지나간 비교 일치 수 (next_cycle 포함)
+static uint64_t timer0_passed(const timer0_t *t, const sim_unit_t *u) {
+    uint64_t now = timer0_ns_to_cycle(u, sim_clk_io_ns(u));
+    return now < t->next_cycle ? 0 : (now - t->next_cycle) / timer0_period(t, u) + 1;
+}
+
+static void timer0_on_write(sim_unit_t *u, void *ctx, uint16_t addr, uint8_t old_val, uint8_t new_val) {
+    timer0_t *t = (timer0_t *)ctx;
+    (void)old_val;
+
+    if (addr != SIM_ADDR_TCCR0 && addr != SIM_ADDR_OCR0 && addr != SIM_ADDR_TCNT0) {
+        return;
+    }
+    // 새 값이 적용되기 전의 설정으로 지금까지 센 값을 정리합니다.
+    if (addr == SIM_ADDR_TCCR0 || addr == SIM_ADDR_OCR0) {
+        uint8_t cur = u->io[addr];
+        u->io[addr] = old_val;
+        timer0_rebase(t, u);
+        u->io[addr] = cur;
+    }
+    if (addr == SIM_ADDR_TCCR0) {
+        t->prescale = timer0_prescalers[new_val & 0x07];
+        t->ctc = (new_val & ((1 << WGM01) | (1 << WGM00))) == (1 << WGM01);
+    } else if (addr == SIM_ADDR_TCNT0) {
+        t->base_cycle = timer0_ns_to_cycle(u, sim_clk_io_ns(u));
+        t->base_cnt = new_val;
+    }
+    timer0_plan(t, u);
+}
+
+static void timer0_on_read(sim_unit_t *u, void *ctx, uint16_t addr) {
+    timer0_t *t = (timer0_t *)ctx;
+
+    // 건너뛰던 중에 펌웨어 코드(다른 ISR 등)가 타이머를 읽으면, 그 전에 지나간 비교 일치를 먼저 정리
+    if (t->ticks && t->ctc && t->next_ns != SIM_NEVER && sim_clk_io_ns(u) >= t->next_ns) {
+        uint64_t passed = timer0_passed(t, u);
+        uint64_t handler = timer0_handler_quiet(t);
+        if (passed > handler) {
+            passed = handler;
+        }
+        if (passed) {
+            timer0_credit(t, u, passed);
+            sim_reschedule(u);
+        }
+    }
+    if (addr == SIM_ADDR_TCNT0) {
+        timer0_rebase(t, u);
+        timer0_plan(t, u);
+        u->io[SIM_ADDR_TCNT0] = t->base_cnt;
+    }
+}
+
+static uint64_t timer0_next(sim_unit_t *u, void *ctx) {
+    const timer0_t *t = (const timer0_t *)ctx;
+    uint64_t quiet;
+
+    if (t->next_ns == SIM_NEVER || (u->sleeping && u->sleep_mode != SIM_SLEEP_IDLE)) {
+        return SIM_NEVER;
+    }
+    if (!u->sleeping && !u->in_delay) {     // 펌웨어 코드가 도는 중에는 건너뛰지 않음 (레지스터 접근마다 불림)
+        return t->next_ns + u->clk_io_stopped_ns;
+    }
+    quiet = timer0_quiet(t, u);
+    if (quiet) {                    // 건너뛸 수 있는 비교 일치 다음의 첫 비교 일치
+        return timer0_cycle_to_ns(u, t->next_cycle + quiet * timer0_period(t, u)) + u->clk_io_stopped_ns;
+    }
+    return t->next_ns + u->clk_io_stopped_ns;
+}
+
+static void timer0_event(sim_unit_t *u, void *ctx) {
+    timer0_t *t = (timer0_t *)ctx;
+    uint8_t ocr;
+    uint32_t steps;
+
+    // 건너뛴 비교 일치 정리: 마지막 것 전까지는 next_event가 ISR 없이 지나가도록 잡은 구간
+    // 마지막 것도 건너뛸 수 있거나, 대기/슬립이 끝나 이미 지난 시각이 된 경우에는 ISR 없이 처리합니다.
+    if (t->ticks && t->ctc) {
+        uint64_t passed = timer0_passed(t, u);
+        uint64_t folded = passed ? passed - 1 : 0;
+        uint64_t last = t->next_cycle + folded * timer0_period(t, u);
+
+        if (passed && (timer0_quiet(t, u) >= passed ||
+                       (last < timer0_ns_to_cycle(u, sim_clk_io_ns(u)) && timer0_handler_quiet(t) >= passed))) {
+            folded = passed;
+        }
+        if (folded) {
+            timer0_credit(t, u, folded);
+            if (folded == passed) {
+                return;
+            }
+        }
+    }
+    ocr = u->io[SIM_ADDR_OCR0];
+    steps = (uint32_t)((t->next_cycle - t->base_cycle) / t->prescale);
+
+    t->base_cycle = t->next_cycle;
+    if (!t->ctc && t->base_cnt + steps == 0x100) {      // 0xFF → 0x00
+        t->overflows++;
+        t->base_cnt = 0;
+        sim_irq_flag(u, 16);                            // TIMER0_OVF
+        if (ocr == 0xFF) {                              // 0xFF 다음 클럭이 오버플로와 같은 클럭
+            t->compares++;
+            sim_irq_flag(u, 15);
+        }
+    } else {
+        t->compares++;
+        t->base_cnt = t->ctc ? 0 : (uint8_t)(ocr + 1);  // TCNT0 == OCR0 다음 클럭 (CTC는 이 클럭에 0)
+        sim_irq_flag(u, 15);                            // TIMER0_COMP
+    }
+    timer0_plan(t, u);
+}
+
+// 설정 레지스터와, 건너뛰기 판단(timer0_quiet)이 보는 인터럽트 관련 레지스터
+static const uint8_t timer0_regs[] = {
+    SIM_ADDR_TCCR0, SIM_ADDR_OCR0, SIM_ADDR_TCNT0, SIM_ADDR_TIMSK, SIM_ADDR_TIFR, SIM_ADDR_SREG, 0
+};
+
+const sim_periph_t timer0_periph = {
+    "timer0",
+    timer0_on_write,
+    timer0_on_read,
+    timer0_next,
+    timer0_event,
+    timer0_regs
+};
@@ -0,0 +1,47 @@
+// =========================================================================
+// 파일명: timer0.h
+// 기능: ATmega128 Timer/Counter0 모델 (동기 클럭 모드)
+//       - 분주비(CS02:0), Normal / CTC / Fast PWM 모드의 카운트 주기를 CPU 클럭 단위로 정확히 계산하고,
+//         비교 일치(OCF0)와 오버플로(TOV0) 시각에 플래그를 세워 인터럽트를 발생시킵니다.
+//       - TCNT0를 읽으면 그 시각의 카운트 값을 돌려줍니다.
+//       - clkIO가 멈추는 슬립(파워다운 등) 동안에는 카운트도 멈춥니다. (ASSR 비동기 모드는 모델링하지 않음)
+//       - Phase Correct PWM은 Normal 모드와 같은 주기로 취급합니다.
+//       - 틱 건너뛰기(timer0_fold): CTC 비교 일치 ISR이 펌웨어의 틱 카운터만 올리는 구간은
+//         주기마다 이벤트를 만들지 않고 한 번에 지나간 뒤, 건너뛴 수만큼 카운터에 더합니다.
+//         ISR 뒤에 펌웨어 코드가 레지스터를 건드리지 않는 경우에만 적용합니다.
+//           * 지연 함수(_delay_ms/_delay_us) 안
+//           * Idle 슬립 중이고, 펌웨어의 슬립 루프(power_idle_for)가 깨어날 틱(timer_wake_due) 전
+//         판단에 쓰는 값은 Timer0 레지스터, 슬립 상태, 타이머 모듈의 틱 카운터·핸들러/깨어남 예정 틱뿐입니다.
+// =========================================================================
+
+#ifndef TIMER0_H_
+#define TIMER0_H_
+
+#include "sim.h"
+
+typedef struct {
+    uint16_t prescale;          // 0이면 정지
+    uint8_t  ctc;               // CTC 모드 (TOP = OCR0)
+    uint8_t  base_cnt;          // base_cycle 시점의 TCNT0
+    uint64_t base_cycle;        // clkIO 기준 CPU 클럭 수
+    uint64_t next_cycle;        // 다음 이벤트 (비교 일치 또는 오버플로) 시각
+    uint64_t next_ns;           // next_cycle을 clkIO ns로 바꾼 값 (SIM_NEVER = 없음)
+
+    uint32_t compares;          // 비교 일치 횟수 (건너뛴 것 포함)
+    uint32_t overflows;         // 오버플로 횟수
+    uint64_t folded;            // ISR 없이 건너뛴 비교 일치 횟수
+
+    // 틱 건너뛰기 (ticks가 NULL이면 사용하지 않음)
+    volatile unsigned long *ticks;  // 펌웨어의 틱 카운터 (비교 일치 ISR마다 1 증가)
+    volatile unsigned long *due;    // 펌웨어가 틱 핸들러를 다음으로 부를 틱 (이 값에 닿는 비교 일치는 ISR을 실행)
+    volatile unsigned long *wake;   // Idle 슬립 루프가 끝나는 틱 (이 값에 닿는 비교 일치는 ISR을 실행, NULL이면 슬립 중 건너뛰지 않음)
+} timer0_t;
+
+extern const sim_periph_t timer0_periph;
+
+void timer0_init(timer0_t *t);
+// 틱 건너뛰기 설정: wake가 NULL이면 지연 함수 안에서만 건너뜁니다.
+void timer0_fold(timer0_t *t, volatile unsigned long *ticks, volatile unsigned long *due,
+                 volatile unsigned long *wake);
+
+#endif /* TIMER0_H_ */
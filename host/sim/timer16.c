@@ -0,0 +1,191 @@
+// =========================================================================
+// 파일명: timer16.c
+// 기능: Timer/Counter1, 3 모델 구현
+//       timer0.c와 같은 방식으로 시간을 clkIO 기준 CPU 클럭 수로 다루고,
+//       가장 가까운 비교 일치/오버플로 시각 하나만 예약합니다.
+// =========================================================================
+
+#include "timer16.h"
+
+#include <string.h>
+#include <avr/io.h>
+
+const timer16_regs_t timer16_t1 = { "timer1", 0x4F, 0x4E, 0x4C, 0x4A, 0x48, 0x46, 12, 13, 14 };
+const timer16_regs_t timer16_t3 = { "timer3", 0x8B, 0x8A, 0x88, 0x86, 0x84, 0x80, 26, 27, 29 };
+
+static const uint16_t timer16_prescalers[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };  // 외부 클럭(Tn 핀)은 정지로 취급
+
+#define TIMER16_NONE    UINT32_MAX
+
+void timer16_init(timer16_t *t, const timer16_regs_t *r) {
+    memset(t, 0, sizeof(*t));
+    t->r = r;
+    t->next_ns = SIM_NEVER;
+}
+
+static uint64_t timer16_ns_to_cycle(const sim_unit_t *u, uint64_t ns) {
+    return (ns / 1000000000ULL) * u->f_cpu + (ns % 1000000000ULL) * u->f_cpu / 1000000000ULL;
+}
+
+// 해당 클럭이 시작되는 시각 (올림)
+static uint64_t timer16_cycle_to_ns(const sim_unit_t *u, uint64_t cycle) {
+    return (cycle / u->f_cpu) * 1000000000ULL + ((cycle % u->f_cpu) * 1000000000ULL + u->f_cpu - 1) / u->f_cpu;
+}
+
+static uint32_t timer16_rd(const sim_unit_t *u, uint8_t addr) {
+    return (uint32_t)u->io[addr] | ((uint32_t)u->io[addr + 1] << 8);
+}
+
+static uint32_t timer16_top(const timer16_t *t, const sim_unit_t *u) {
+    switch (t->wgm) {
+        case 1: case 5:                     return 0x00FF;
+        case 2: case 6:                     return 0x01FF;
+        case 3: case 7:                     return 0x03FF;
+        case 4: case 9: case 11: case 15:   return timer16_rd(u, t->r->ocra);
+        case 8: case 10: case 12: case 14:  return timer16_rd(u, t->r->icr);
+        default:                            return 0xFFFF;
+    }
+}
+
+// CTC 모드에서는 TOP에서 0으로 돌아갈 때 TOVn이 서지 않음 (0xFFFF → 0일 때만)
+static int timer16_ctc(const timer16_t *t) {
+    return t->wgm == 4 || t->wgm == 12;
+}
+
+// 지금(clkIO 기준) 카운트 값을 계산하고 그 시점을 새 기준으로 삼습니다.
+static void timer16_rebase(timer16_t *t, const sim_unit_t *u) {
+    uint64_t now = timer16_ns_to_cycle(u, sim_clk_io_ns(u));
+    if (t->prescale && now > t->base_cycle) {
+        uint64_t steps = (now - t->base_cycle) / t->prescale;
+        uint32_t top = timer16_top(t, u);
+        uint32_t cnt = t->base_cnt;
+        // TOP보다 큰 값에서 출발했다면 (CTC에서 OCRnA를 줄인 경우) 0xFFFF까지 센 뒤 0으로 돌아감
+        if (cnt > top) {
+            uint64_t to_wrap = 0x10000 - cnt;
+            if (steps < to_wrap) {
+                cnt += (uint32_t)steps;
+                steps = 0;
+            } else {
+                steps -= to_wrap;
+                cnt = 0;
+            }
+        }
+        if (cnt <= top) {
+            cnt = (uint32_t)((cnt + steps % (top + 1)) % (top + 1));
+        }
+        t->base_cnt = (uint16_t)cnt;
+        t->base_cycle = now - (now - t->base_cycle) % t->prescale;
+    } else {
+        t->base_cycle = now;
+    }
+}
+
+// cnt에서 출발해 v에 처음 도달할 때까지의 카운트 수 (1 이상, 도달하지 않으면 TIMER16_NONE)
+static uint32_t timer16_dist(uint32_t cnt, uint32_t v, uint32_t top) {
+    if (v > cnt && (v <= top || cnt > top)) {
+        return v - cnt;
+    }
+    if (v > top) {
+        return TIMER16_NONE;
+    }
+    return (cnt > top ? 0x10000 : top + 1) - cnt + v;
+}
+
+// base 이후 처음으로 비교 일치 A/B 또는 0으로 돌아가는 시각을 구합니다.
+static void timer16_plan(timer16_t *t, const sim_unit_t *u) {
+    uint32_t top = timer16_top(t, u);
+    uint32_t cnt = t->base_cnt;
+    uint32_t d = timer16_dist(cnt, 0, top);
+    uint32_t da = timer16_dist(cnt, timer16_rd(u, t->r->ocra), top);
+    uint32_t db = timer16_dist(cnt, timer16_rd(u, t->r->ocrb), top);
+
+    if (t->prescale == 0) {
+        t->next_ns = SIM_NEVER;
+        return;
+    }
+    if (da < d) {
+        d = da;
+    }
+    if (db < d) {
+        d = db;
+    }
+    t->next_cycle = t->base_cycle + (uint64_t)d * t->prescale;
+    t->next_ns = timer16_cycle_to_ns(u, t->next_cycle);
+}
+
+static void timer16_on_write(sim_unit_t *u, void *ctx, uint16_t addr, uint8_t old_val, uint8_t new_val) {
+    timer16_t *t = (timer16_t *)ctx;
+    const timer16_regs_t *r = t->r;
+    (void)new_val;
+
+    if (addr == r->tcnt || addr == r->tcnt + 1) {
+        t->base_cycle = timer16_ns_to_cycle(u, sim_clk_io_ns(u));
+        t->base_cnt = (uint16_t)timer16_rd(u, r->tcnt);
+    } else if (addr == r->tccra || addr == r->tccrb || addr == r->ocra || addr == r->ocra + 1 ||
+               addr == r->icr || addr == r->icr + 1) {
+        // 새 값이 적용되기 전의 설정(분주비, TOP)으로 지금까지 센 값을 정리합니다.
+        uint8_t cur = u->io[addr];
+        u->io[addr] = old_val;
+        timer16_rebase(t, u);
+        u->io[addr] = cur;
+        t->prescale = timer16_prescalers[u->io[r->tccrb] & 0x07];
+        t->wgm = (uint8_t)((u->io[r->tccra] & 0x03) | ((u->io[r->tccrb] >> 1) & 0x0C));
+    } else if (addr != r->ocrb && addr != r->ocrb + 1) {
+        return;
+    }
+    timer16_plan(t, u);
+}
+
+static void timer16_on_read(sim_unit_t *u, void *ctx, uint16_t addr) {
+    timer16_t *t = (timer16_t *)ctx;
+    if (addr == t->r->tcnt || addr == t->r->tcnt + 1) {
+        timer16_rebase(t, u);
+        timer16_plan(t, u);
+        u->io[t->r->tcnt] = (uint8_t)t->base_cnt;
+        u->io[t->r->tcnt + 1] = (uint8_t)(t->base_cnt >> 8);
+    }
+}
+
+static uint64_t timer16_next(sim_unit_t *u, void *ctx) {
+    const timer16_t *t = (const timer16_t *)ctx;
+    if (t->next_ns == SIM_NEVER || (u->sleeping && u->sleep_mode != SIM_SLEEP_IDLE)) {
+        return SIM_NEVER;
+    }
+    return t->next_ns + u->clk_io_stopped_ns;
+}
+
+static void timer16_event(sim_unit_t *u, void *ctx) {
+    timer16_t *t = (timer16_t *)ctx;
+    uint32_t top = timer16_top(t, u);
+    uint32_t cnt = t->base_cnt + (uint32_t)((t->next_cycle - t->base_cycle) / t->prescale);
+    int ovf = 0;
+
+    // 예약한 시각은 첫 이벤트이므로 그 사이에 0으로 돌아간 일은 많아야 한 번 (바로 이 시각)
+    if (cnt == 0x10000 || (t->base_cnt <= top && cnt == top + 1)) {
+        ovf = (cnt == 0x10000) || !timer16_ctc(t);
+        cnt = 0;
+    }
+    t->base_cycle = t->next_cycle;
+    t->base_cnt = (uint16_t)cnt;
+    if (ovf) {
+        t->overflows++;
+        sim_irq_flag(u, t->r->vec_ovf);
+    }
+    if (cnt == timer16_rd(u, t->r->ocra)) {
+        t->compares_a++;
+        sim_irq_flag(u, t->r->vec_compa);
+    }
+    if (cnt == timer16_rd(u, t->r->ocrb)) {
+        t->compares_b++;
+        sim_irq_flag(u, t->r->vec_compb);
+    }
+    timer16_plan(t, u);
+}
+
+const sim_periph_t timer16_periph = {
+    "timer16",
+    timer16_on_write,
+    timer16_on_read,
+    timer16_next,
+    timer16_event
+};
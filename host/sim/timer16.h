@@ -0,0 +1,46 @@
+// =========================================================================
+// 파일명: timer16.h
+// 기능: ATmega128 16비트 Timer/Counter1, 3 모델 (동기 클럭 모드)
+//       - 분주비(CSn2:0)와 WGMn3:0에서 정해지는 TOP(0xFFFF, 0x00FF/0x01FF/0x03FF, OCRnA, ICRn)으로
+//         카운트 주기를 CPU 클럭 단위로 계산하고, 비교 일치 A/B(OCFnA/B)와 오버플로(TOVn) 시각에
+//         플래그를 세워 인터럽트를 발생시킵니다.
+//       - TCNTn을 읽으면 그 시각의 카운트 값을 돌려줍니다.
+//       - PWM 모드의 OCRn 이중 버퍼, Phase Correct의 내려가는 구간, 출력 핀(OCnx), 입력 캡처는 모델링하지 않습니다.
+//         (Phase Correct는 같은 TOP의 Fast PWM과 같은 주기로 취급)
+// =========================================================================
+
+#ifndef TIMER16_H_
+#define TIMER16_H_
+
+#include "sim.h"
+
+// 타이머 하나의 레지스터 주소와 인터럽트 (timer16_t1, timer16_t3)
+typedef struct {
+    const char *name;
+    uint8_t tccra, tccrb;       // 제어 레지스터 주소
+    uint8_t tcnt, ocra, ocrb, icr;  // 16비트 레지스터의 L 주소 (H는 +1)
+    uint8_t vec_compa, vec_compb, vec_ovf;
+} timer16_regs_t;
+
+extern const timer16_regs_t timer16_t1;
+extern const timer16_regs_t timer16_t3;
+
+typedef struct {
+    const timer16_regs_t *r;
+    uint16_t prescale;          // 0이면 정지
+    uint8_t  wgm;               // WGMn3:0
+    uint16_t base_cnt;          // base_cycle 시점의 TCNTn
+    uint64_t base_cycle;        // clkIO 기준 CPU 클럭 수
+    uint64_t next_cycle;        // 다음 이벤트 (비교 일치 또는 오버플로) 시각
+    uint64_t next_ns;           // next_cycle을 clkIO ns로 바꾼 값 (SIM_NEVER = 없음)
+
+    uint32_t compares_a;        // 비교 일치 횟수
+    uint32_t compares_b;
+    uint32_t overflows;         // 오버플로 횟수
+} timer16_t;
+
+extern const sim_periph_t timer16_periph;
+
+void timer16_init(timer16_t *t, const timer16_regs_t *r);
+
+#endif /* TIMER16_H_ */
@@ -0,0 +1,422 @@
+// =========================================================================
+// 파일명: soak.c
+// 기능: Project1.4 상태 머신(main.c)에 무작위/문법 기반 키 입력을 대량으로 넣는 소크(퍼징) 드라이버
+//       - 펌웨어가 키패드를 폴링하는 순간에 바로 다음 키를 누르고, 디바운스 대기가 끝나면 떼므로
+//         표시 유지 시간(최대 5초)과 상관없이 키 입력이 빈틈없이 이어집니다.
+//       - 키 처리가 끝나고 펌웨어가 다시 폴링을 시작할 때마다 불변 조건을 검사합니다.
+//           * password_index 범위(0~7), entered_password / stored_password 널 종료와 버퍼 내용
+//           * 현재 상태가 기준 모델(사양대로 동작하는 상태 머신)과 같은지
+//           * LCD 두 줄(가상 HD44780의 DDRAM)이 기준 모델의 기대 문자열과 같은지, LED가 꺼져 있는지
+//       - 종료 시 상태별 도달 횟수, 상태 전이 행렬, 초당 처리 키 수(events/s)를 출력합니다.
+//
+// 사용법: soak [-n 키수] [-g 문법기반비율%] [-s 시드] [-v 최대보고수]
+// =========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sim.h"
+#include "timer0.h"
+#include "lockboard.h"
+#include "timer/timer.h"     // 펌웨어의 틱 카운터 (timer_ticks, timer_handler_due, timer_wake_due)
+
+#define SOAK_F_CPU          14745600UL  // main.c의 F_CPU와 동일
+#define MS                  1000000ULL
+#define SOAK_DEBOUNCE_NS    (40 * MS)   // 펌웨어의 디바운스 대기(50ms)가 지났다고 볼 시점
+#define SOAK_HISTORY        24          // 위반 보고 시 함께 출력할 최근 키 수
+
+// main.c와 같은 값 (펌웨어 헤더가 아니라 main.c 안에 정의되어 있음)
+#define MAX_PASSWORD_LENGTH     7
+#define ADMIN_PASSWORD          "98765"
+#define ADMIN_PASSWORD_LENGTH   5
+
+enum { ST_INPUT, ST_ADMIN, ST_CHANGE, ST_COUNT };
+static const char *const state_name[ST_COUNT] = { "INPUT", "ADMIN", "CHANGE" };
+
+// -Dmain=firmware_main 으로 정적 링크된 펌웨어의 전역 변수
+int firmware_main(void);
+extern volatile int  current_program_state;
+extern volatile char stored_password[MAX_PASSWORD_LENGTH + 1];
+extern char          entered_password[MAX_PASSWORD_LENGTH + 1];
+extern int           password_index;
+
+// -------------------------------------------------------------------------
+// 1. 기준 모델: main.c의 사양을 그대로 옮긴 상태 머신과 기대 화면
+// -------------------------------------------------------------------------
+
+typedef struct {
+    int  state;
+    char stored[MAX_PASSWORD_LENGTH + 1];
+    char entered[MAX_PASSWORD_LENGTH + 1];
+    int  index;
+    char row[2][HD44780_COLS + 1];
+} model_t;
+
+static void model_show(model_t *m, const char *row0, const char *row1) {
+    snprintf(m->row[0], sizeof(m->row[0]), "%s", row0);
+    snprintf(m->row[1], sizeof(m->row[1]), "%s", row1);
+}
+
+static void model_reset(model_t *m) {
+    m->state = ST_INPUT;
+    m->index = 0;
+    memset(m->entered, 0, sizeof(m->entered));
+    model_show(m, "Input PassWord", "");
+}
+
+static void model_init(model_t *m) {
+    memset(m, 0, sizeof(*m));
+    strcpy(m->stored, "1234567");
+    model_reset(m);
+}
+
+static void model_digit(model_t *m, char key) {
+    if (m->index < MAX_PASSWORD_LENGTH) {
+        m->entered[m->index++] = key;
+        m->entered[m->index] = '\0';
+    }
+    snprintf(m->row[1], sizeof(m->row[1]), "%s", m->entered);
+}
+
+// 키 하나를 사양대로 처리합니다. (표시 유지 후의 최종 화면만 남김)
+static void model_key(model_t *m, char key) {
+    switch (m->state) {
+        case ST_INPUT:
+            if (key == '*') {
+                if (m->index > 0) {
+                    m->entered[--m->index] = '\0';
+                }
+                snprintf(m->row[1], sizeof(m->row[1]), "%s", m->entered);
+            } else if (key == '#') {
+                if (m->index == MAX_PASSWORD_LENGTH) {
+                    model_reset(m);     // "OPEN" 또는 "Not PassWord" 표시 후 초기화
+                } else if (m->index == ADMIN_PASSWORD_LENGTH && strcmp(m->entered, ADMIN_PASSWORD) == 0) {
+                    m->state = ST_ADMIN;
+                    m->index = 0;
+                    memset(m->entered, 0, sizeof(m->entered));
+                    model_show(m, "Admin Mode", "# for New PWD");
+                } else if (m->index == ADMIN_PASSWORD_LENGTH) {
+                    model_reset(m);     // "Not Admin PWD" 표시 후 초기화
+                }
+                // 그 외 길이: "7 or 5 digits" 안내 후 입력한 숫자를 그대로 다시 표시
+            } else {
+                model_digit(m, key);
+            }
+            break;
+
+        case ST_ADMIN:
+            if (key == '#') {
+                m->state = ST_CHANGE;
+                m->index = 0;
+                memset(m->entered, 0, sizeof(m->entered));
+                model_show(m, "Enter New PWD", "");
+            } else if (key == '*') {
+                model_reset(m);
+            }
+            // 그 외: "Invalid Key" 안내 후 "# for New PWD"로 복구
+            break;
+
+        case ST_CHANGE:
+            if (key == '*') {
+                model_reset(m);
+            } else if (key == '#') {
+                if (m->index == MAX_PASSWORD_LENGTH) {
+                    strcpy(m->stored, m->entered);
+                    model_reset(m);
+                }
+                // 그 외: "7 digits Req" 안내 후 입력한 숫자를 그대로 다시 표시
+            } else {
+                model_digit(m, key);
+            }
+            break;
+    }
+}
+
+// -------------------------------------------------------------------------
+// 2. 키 스트림 생성 (무작위 + 문법 기반)
+// -------------------------------------------------------------------------
+
+static const char soak_keys[] = "0123456789*#";
+
+typedef struct {
+    uint64_t rng;
+    unsigned grammar_pct;       // 문법 기반 토큰의 비율 (나머지는 완전 무작위 키)
+    char     queue[64];
+    int      head, tail;
+} keygen_t;
+
+static uint32_t rng_next(uint64_t *s) {
+    *s ^= *s >> 12;
+    *s ^= *s << 25;
+    *s ^= *s >> 27;
+    return (uint32_t)((*s * 2685821657736338717ULL) >> 32);
+}
+
+static uint32_t rng_below(uint64_t *s, uint32_t n) {
+    return (uint32_t)(((uint64_t)rng_next(s) * n) >> 32);
+}
+
+static void gen_push(keygen_t *g, char key) {
+    if (g->tail < (int)sizeof(g->queue)) {
+        g->queue[g->tail++] = key;
+    }
+}
+
+static void gen_digits(keygen_t *g, int n) {
+    while (n-- > 0) gen_push(g, (char)('0' + rng_below(&g->rng, 10)));
+}
+
+// 한 자리만 바꾼 비밀번호 (정답/관리자 비밀번호와 아주 가까운 오답)
+static void gen_near(keygen_t *g, const char *pw) {
+    int len = (int)strlen(pw), at = (int)rng_below(&g->rng, (uint32_t)len);
+    for (int i = 0; i < len; i++) {
+        gen_push(g, i == at ? (char)('0' + (pw[i] - '0' + 1 + rng_below(&g->rng, 9)) % 10) : pw[i]);
+    }
+}
+
+// 토큰 하나를 큐에 채웁니다. 현재 비밀번호는 기준 모델에서 가져옵니다.
+static void gen_token(keygen_t *g, const model_t *m) {
+    g->head = g->tail = 0;
+    if (rng_below(&g->rng, 100) >= g->grammar_pct) {
+        gen_push(g, soak_keys[rng_below(&g->rng, 12)]);
+        return;
+    }
+    switch (rng_below(&g->rng, 10)) {
+        case 0: gen_digits(g, (int)rng_below(&g->rng, 10)); gen_push(g, '#'); break;  // 길이 0~9 입력 후 확인
+        case 1: for (int i = (int)rng_below(&g->rng, 4); i >= 0; i--) gen_push(g, '#'); break;  // 연속 '#'
+        case 2: for (int i = (int)rng_below(&g->rng, 9); i >= 0; i--) gen_push(g, '*'); break;  // 빈 버퍼 '*' 포함
+        case 3: gen_digits(g, 7 + (int)rng_below(&g->rng, 5)); break;                  // 길이 초과 입력
+        case 4: gen_near(g, m->stored); gen_push(g, '#'); break;
+        case 5: gen_near(g, ADMIN_PASSWORD); gen_push(g, '#'); break;
+        case 6: for (const char *p = m->stored; *p; p++) gen_push(g, *p); gen_push(g, '#'); break;
+        case 7: for (const char *p = ADMIN_PASSWORD; *p; p++) gen_push(g, *p); gen_push(g, '#'); break;
+        case 8:                                                                          // 관리자 모드에서 비밀번호 변경
+            for (const char *p = ADMIN_PASSWORD "#"; *p; p++) gen_push(g, *p);
+            if (rng_below(&g->rng, 4) == 0) gen_digits(g, 1);                            // "Invalid Key"
+            gen_push(g, '#');
+            gen_digits(g, 5 + (int)rng_below(&g->rng, 4));
+            gen_push(g, '#');
+            break;
+        default: gen_digits(g, (int)rng_below(&g->rng, 8)); gen_push(g, '*'); gen_digits(g, 2); break;
+    }
+}
+
+static char gen_next(keygen_t *g, const model_t *m) {
+    while (g->head >= g->tail) {
+        gen_token(g, m);
+    }
+    return g->queue[g->head++];
+}
+
+// -------------------------------------------------------------------------
+// 3. 드라이버 (sim_periph_t): 폴링 시점에 맞춰 키를 누르고 떼며 불변 조건을 검사
+// -------------------------------------------------------------------------
+
+typedef enum {
+    PHASE_SETTLING,             // 키를 뗐고, 펌웨어가 처리를 끝내고 다시 폴링하기를 기다림
+    PHASE_HELD                  // 키를 누르고 있음 (디바운스 대기가 끝나면 뗌)
+} phase_t;
+
+typedef struct {
+    lockboard_t board;
+    model_t   model;
+    keygen_t  gen;
+    phase_t   phase;
+    uint64_t  phase_ns;
+    char      key;
+    int       prev_state;
+
+    uint64_t  limit;
+    uint64_t  events;
+    uint64_t  violations;
+    uint64_t  max_reports;
+    uint64_t  state_visits[ST_COUNT];
+    uint64_t  transitions[ST_COUNT][ST_COUNT];
+    char      history[SOAK_HISTORY];
+} soak_t;
+
+static void report(soak_t *s, const char *what, const char *detail) {
+    s->violations++;
+    if (s->violations > s->max_reports) {
+        return;
+    }
+    printf("violation after %llu keys: %s%s%s\n", (unsigned long long)s->events, what,
+           detail ? ": " : "", detail ? detail : "");
+    printf("  recent keys: ");
+    for (int i = 0; i < SOAK_HISTORY; i++) {
+        char c = s->history[(s->events + (uint64_t)i) % SOAK_HISTORY];
+        if (c) putchar(c);
+    }
+    printf("\n  model: state %s, index %d, entered \"%s\", rows \"%s\" / \"%s\"\n",
+           state_name[s->model.state], s->model.index, s->model.entered, s->model.row[0], s->model.row[1]);
+}
+
+// 펌웨어가 키 처리를 끝내고 폴링으로 돌아온 시점의 불변 조건
+static void check_invariants(soak_t *s) {
+    model_t *m = &s->model;
+    char buf[64], row[HD44780_COLS + 1];
+    int state = current_program_state;
+
+    if (state < 0 || state >= ST_COUNT) {
+        snprintf(buf, sizeof(buf), "%d", state);
+        report(s, "state out of range", buf);
+        return;
+    }
+    s->state_visits[state]++;
+    s->transitions[s->prev_state][state]++;
+    s->prev_state = state;
+
+    if (state != m->state) {
+        snprintf(buf, sizeof(buf), "firmware %s, model %s", state_name[state], state_name[m->state]);
+        report(s, "state mismatch", buf);
+    }
+    if (password_index < 0 || password_index > MAX_PASSWORD_LENGTH) {
+        snprintf(buf, sizeof(buf), "%d", password_index);
+        report(s, "password_index out of bounds", buf);
+    } else if (entered_password[password_index] != '\0') {
+        report(s, "entered_password not NUL-terminated at password_index", 0);
+    }
+    if (memchr(entered_password, '\0', sizeof(entered_password)) == 0) {
+        report(s, "entered_password not NUL-terminated", 0);
+    }
+    if (memcmp(entered_password, m->entered, sizeof(m->entered)) != 0 || password_index != m->index) {
+        snprintf(buf, sizeof(buf), "firmware \"%.*s\" (%d), model \"%s\" (%d)", MAX_PASSWORD_LENGTH,
+                 entered_password, password_index, m->entered, m->index);
+        report(s, "entered_password mismatch", buf);
+    }
+    if (stored_password[MAX_PASSWORD_LENGTH] != '\0' || strcmp((const char *)stored_password, m->stored) != 0) {
+        snprintf(buf, sizeof(buf), "firmware \"%.*s\", model \"%s\"", MAX_PASSWORD_LENGTH,
+                 (const char *)stored_password, m->stored);
+        report(s, "stored_password mismatch", buf);
+    }
+    for (int r = 0; r < 2; r++) {
+        hd44780_row(&s->board.lcd, r, row);
+        if (strcmp(row, m->row[r]) != 0) {
+            snprintf(buf, sizeof(buf), "row %d is \"%s\", expected \"%s\"", r, row, m->row[r]);
+            report(s, "LCD mismatch", buf);
+        }
+    }
+    if (s->board.led != 0) {
+        report(s, "LED left on", lockboard_led_name(s->board.led));
+    }
+}
+
+static void soak_on_read(sim_unit_t *u, void *ctx, uint16_t addr) {
+    soak_t *s = (soak_t *)ctx;
+
+    if (addr != SIM_ADDR_PIND || u->now_ns - s->phase_ns < SOAK_DEBOUNCE_NS) {
+        return;
+    }
+    if (s->phase == PHASE_HELD) {
+        lockboard_release(&s->board, u);
+        s->phase = PHASE_SETTLING;
+        s->phase_ns = u->now_ns;
+        return;
+    }
+
+    check_invariants(s);
+    if (s->events >= s->limit) {
+        sim_stop(u);
+    }
+    s->key = gen_next(&s->gen, &s->model);
+    s->history[s->events % SOAK_HISTORY] = s->key;
+    s->events++;
+    model_key(&s->model, s->key);
+    lockboard_press(&s->board, u, s->key);
+    s->phase = PHASE_HELD;
+    s->phase_ns = u->now_ns;
+}
+
+static const uint8_t soak_regs[] = { SIM_ADDR_PIND, 0 };
+
+static const sim_periph_t soak_periph = {
+    "soak",
+    0,
+    soak_on_read,
+    0,
+    0,
+    soak_regs
+};
+
+// -------------------------------------------------------------------------
+// 4. main
+// -------------------------------------------------------------------------
+
+int main(int argc, char **argv) {
+    static sim_unit_t unit;
+    static soak_t soak;
+    static timer0_t timer0;
+    struct timespec t0, t1;
+    int opt;
+
+    soak.limit = 1000000;
+    soak.max_reports = 10;
+    soak.gen.grammar_pct = 70;
+    soak.gen.rng = 1;
+    while ((opt = getopt(argc, argv, "n:g:s:v:")) != -1) {
+        switch (opt) {
+            case 'n': soak.limit = strtoull(optarg, 0, 10); break;
+            case 'g': soak.gen.grammar_pct = (unsigned)atoi(optarg); break;
+            case 's': soak.gen.rng = strtoull(optarg, 0, 10) * 0x9E3779B97F4A7C15ULL | 1; break;
+            case 'v': soak.max_reports = strtoull(optarg, 0, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n keys] [-g grammar%%] [-s seed] [-v max-reports]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    sim_unit_init(&unit, SOAK_F_CPU);
+    sim_bind_vectors(&unit);
+    lockboard_init(&soak.board);
+    soak.board.idle_skip = 0;           // 드라이버가 폴링에 맞춰 키를 넣으므로 건너뛸 유휴 구간이 없음
+    model_init(&soak.model);
+    soak.phase = PHASE_SETTLING;
+
+    // 드라이버가 먼저 키 상태를 바꾼 뒤 보드 모델이 PIND를 계산하도록 soak_periph를 앞에 붙입니다.
+    sim_attach(&unit, &soak_periph, &soak);
+    sim_attach(&unit, &lockboard_periph, &soak.board);
+    timer0_init(&timer0);
+    timer0_fold(&timer0, &timer_ticks, &timer_handler_due, &timer_wake_due);
+    sim_attach(&unit, &timer0_periph, &timer0);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (sim_run(&unit, firmware_main)) {
+        fprintf(stderr, "soak: firmware main() returned\n");
+        return 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double wall_s = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("keys           : %llu (%u%% grammar-guided)\n", (unsigned long long)soak.events, soak.gen.grammar_pct);
+    printf("wall time      : %.3f s, %.0f events/s (%.1fM register accesses + delays/s)\n", wall_s,
+           (double)soak.events / wall_s, (double)(unit.io_accesses + unit.delay_calls) / wall_s / 1e6);
+    printf("virtual time   : %.1f h\n", (double)unit.now_ns / 3.6e12);
+    printf("io / isr       : %llu io accesses (%.0f per key), %llu ISRs\n", (unsigned long long)unit.io_accesses,
+           (double)unit.io_accesses / (double)(soak.events ? soak.events : 1), (unsigned long long)unit.isr_calls);
+    printf("lcd violations : %u busy, %u before power-on\n", soak.board.lcd.busy_violations, soak.board.lcd.early_writes);
+    printf("state visits   :");
+    for (int i = 0; i < ST_COUNT; i++) {
+        printf(" %s %llu", state_name[i], (unsigned long long)soak.state_visits[i]);
+    }
+    printf("\ntransitions    :\n");
+    for (int i = 0; i < ST_COUNT; i++) {
+        printf("  %-6s ->", state_name[i]);
+        for (int j = 0; j < ST_COUNT; j++) {
+            printf(" %s %-9llu", state_name[j], (unsigned long long)soak.transitions[i][j]);
+        }
+        printf("\n");
+    }
+
+    int unreached = 0;
+    for (int i = 0; i < ST_COUNT; i++) {
+        if (soak.state_visits[i] == 0) {
+            printf("unreached state: %s\n", state_name[i]);
+            unreached++;
+        }
+    }
+    printf("violations     : %llu\n", (unsigned long long)soak.violations);
+    return (soak.violations || (unreached && soak.events >= 1000)) ? 1 : 0;
+}